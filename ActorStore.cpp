@@ -0,0 +1,117 @@
+#include "ActorStore.h"
+#include "Kinematics.h"
+#include <algorithm>
+
+ActorStore::Id ActorStore::add(const Actor& a) {
+    posX.push_back(a.position.x);
+    posY.push_back(a.position.y);
+    prevX.push_back(a.position.x);
+    prevY.push_back(a.position.y);
+    velX.push_back(a.velocity.x);
+    velY.push_back(a.velocity.y);
+    width.push_back(a.size.x);
+    height.push_back(a.size.y);
+    walkX.push_back(a.walk);
+    moveX.push_back(0.f);
+    moveY.push_back(0.f);
+    speeds.push_back(a.speed);
+    jumpImpulses.push_back(a.jumpImpulse);
+    lives.push_back(a.lives);
+    grounded.push_back(a.onGround ? 1 : 0);
+    elements.push_back(a.element);
+    return posX.size() - 1;
+}
+
+void ActorStore::clear() {
+    posX.clear(); posY.clear();
+    prevX.clear(); prevY.clear();
+    velX.clear(); velY.clear();
+    width.clear(); height.clear();
+    walkX.clear();
+    moveX.clear(); moveY.clear();
+    speeds.clear(); jumpImpulses.clear();
+    lives.clear();
+    grounded.clear();
+    elements.clear();
+}
+
+void ActorStore::reserve(std::size_t n) {
+    posX.reserve(n); posY.reserve(n);
+    prevX.reserve(n); prevY.reserve(n);
+    velX.reserve(n); velY.reserve(n);
+    width.reserve(n); height.reserve(n);
+    walkX.reserve(n);
+    moveX.reserve(n); moveY.reserve(n);
+    speeds.reserve(n); jumpImpulses.reserve(n);
+    lives.reserve(n);
+    grounded.reserve(n);
+    elements.reserve(n);
+}
+
+ActorStore::Actor ActorStore::get(Id i) const {
+    Actor a;
+    a.position = {posX[i], posY[i]};
+    a.size = {width[i], height[i]};
+    a.velocity = {velX[i], velY[i]};
+    a.walk = walkX[i];
+    a.speed = speeds[i];
+    a.jumpImpulse = jumpImpulses[i];
+    a.lives = lives[i];
+    a.onGround = grounded[i] != 0;
+    a.element = elements[i];
+    return a;
+}
+
+void ActorStore::set(Id i, const Actor& a) {
+    posX[i] = a.position.x;
+    posY[i] = a.position.y;
+    width[i] = a.size.x;
+    height[i] = a.size.y;
+    velX[i] = a.velocity.x;
+    velY[i] = a.velocity.y;
+    walkX[i] = a.walk;
+    speeds[i] = a.speed;
+    jumpImpulses[i] = a.jumpImpulse;
+    lives[i] = a.lives;
+    grounded[i] = a.onGround ? 1 : 0;
+    elements[i] = a.element;
+}
+
+void ActorStore::beginTick() {
+    std::copy(posX.begin(), posX.end(), prevX.begin());
+    std::copy(posY.begin(), posY.end(), prevY.begin());
+}
+
+void ActorStore::integrate(float dt) {
+    Kinematics::integrate({velY.data(), velX.data(), walkX.data(), moveX.data(), moveY.data(), size()},
+                          Gravity, dt);
+    std::fill(walkX.begin(), walkX.end(), 0.f);
+    std::fill(grounded.begin(), grounded.end(), std::uint8_t{0});
+}
+
+void ActorStore::clampToWorld(const sf::FloatRect& world) {
+    Kinematics::clampToWorld({posX.data(), posY.data(), velY.data(), grounded.data(),
+                              width.data(), height.data(), size()}, world);
+}
+
+void ActorStore::saveState(StateBytes::Buffer& out) const {
+    StateBytes::append(out, posX);
+    StateBytes::append(out, posY);
+    StateBytes::append(out, prevX);
+    StateBytes::append(out, prevY);
+    StateBytes::append(out, velX);
+    StateBytes::append(out, velY);
+    StateBytes::append(out, lives);
+    StateBytes::append(out, grounded);
+}
+
+const std::uint8_t* ActorStore::loadState(const std::uint8_t* in) {
+    in = StateBytes::read(in, posX);
+    in = StateBytes::read(in, posY);
+    in = StateBytes::read(in, prevX);
+    in = StateBytes::read(in, prevY);
+    in = StateBytes::read(in, velX);
+    in = StateBytes::read(in, velY);
+    in = StateBytes::read(in, lives);
+    return StateBytes::read(in, grounded);
+}
@@ -0,0 +1,97 @@
+#ifndef OOP_ACTORSTORE_H
+#define OOP_ACTORSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "CollisionRules.h"
+#include "StateBytes.h"
+
+// Starea tuturor actorilor (personaje si NPC-uri) ca structure-of-arrays: fiecare camp intr-un
+// vector separat, indexat cu Id. Buclele de fizica parcurg doar campurile de care au nevoie,
+// contiguu si fara apeluri virtuale; Character ramane doar o fatada peste un Id de aici.
+class ActorStore {
+public:
+    using Id = std::size_t;
+
+    static constexpr float Gravity = 900.f;
+
+    // un actor strans intr-o singura structura: pentru adaugare si pentru fatada Character
+    struct Actor {
+        sf::Vector2f position{}; // coord globale (top-left)
+        sf::Vector2f size{}; // hitbox-ul
+        sf::Vector2f velocity{};
+        float walk = 0.f; // deplasarea orizontala ceruta de input in tick-ul curent
+        float speed = 160.f; // px/s
+        float jumpImpulse = 435.f;
+        int lives = 0;
+        bool onGround = false;
+        Element element = Element::Neutral;
+    };
+
+private:
+    std::vector<float> posX, posY;
+    // pozitia de la inceputul tick-ului, pentru interpolarea desenarii
+    std::vector<float> prevX, prevY;
+    std::vector<float> velX, velY;
+    std::vector<float> width, height;
+    std::vector<float> walkX;
+    // deplasarea dorita in tick-ul curent, calculata de integrate()
+    std::vector<float> moveX, moveY;
+    std::vector<float> speeds, jumpImpulses;
+    std::vector<int> lives;
+    std::vector<std::uint8_t> grounded;
+    std::vector<Element> elements;
+
+public:
+    Id add(const Actor& a);
+    void clear();
+    void reserve(std::size_t n);
+    std::size_t size() const { return posX.size(); }
+
+    // toate campurile unui actor (fatada Character); buclele de fizica folosesc accesorii de mai jos
+    Actor get(Id i) const;
+    void set(Id i, const Actor& a);
+
+    sf::Vector2f position(Id i) const { return {posX[i], posY[i]}; }
+    sf::Vector2f previousPosition(Id i) const { return {prevX[i], prevY[i]}; }
+    sf::Vector2f size(Id i) const { return {width[i], height[i]}; }
+    sf::FloatRect bounds(Id i) const { return sf::FloatRect(posX[i], posY[i], width[i], height[i]); }
+    sf::Vector2f displacement(Id i) const { return {moveX[i], moveY[i]}; }
+    Element element(Id i) const { return elements[i]; }
+    bool onGround(Id i) const { return grounded[i] != 0; }
+
+    void setPosition(Id i, const sf::Vector2f& p) { posX[i] = p.x; posY[i] = p.y; }
+    void setOnGround(Id i, bool state) {
+        grounded[i] = state ? 1 : 0;
+        if (state) velY[i] = 0.f;
+    }
+    void stopVerticalMovement(Id i) { velY[i] = 0.f; }
+    void moveLeft(Id i, float dt) { walkX[i] -= speeds[i] * dt; }
+    void moveRight(Id i, float dt) { walkX[i] += speeds[i] * dt; }
+    void jump(Id i) {
+        if (grounded[i]) {
+            velY[i] = -jumpImpulses[i];
+            grounded[i] = 0;
+        }
+    }
+
+    // pentru toti actorii, cate o bucla (SIMD, prin Kinematics) pe campurile implicate:
+    // pozitiile curente devin capatul anterior al interpolarii
+    void beginTick();
+    // gravitatia pe un tick si deplasarea dorita (mers + viteza * dt), citita apoi cu displacement();
+    // daca actorul sta pe sol, coliziunea il opreste la t=0 si il marcheaza din nou onGround
+    void integrate(float dt);
+    // tine actorii in interiorul lumii; fundul lumii conteaza ca sol
+    void clampToWorld(const sf::FloatRect& world);
+
+    // campurile care se schimba de la un tick la altul (pozitii, viteze, vieti, sol), pentru rewind;
+    // restul sunt fixe cat timp nu se adauga actori
+    void saveState(StateBytes::Buffer& out) const;
+    // citeste ce a scris saveState pentru acelasi numar de actori; intoarce pozitia de dupa
+    const std::uint8_t* loadState(const std::uint8_t* in);
+};
+
+#endif // OOP_ACTORSTORE_H
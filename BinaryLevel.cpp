@@ -0,0 +1,120 @@
+#include "BinaryLevel.h"
+#include "GameExceptions.h"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+    constexpr char Magic[4] = {'F', 'B', 'W', 'L'};
+    constexpr std::uint32_t TileAlignment = 64;
+
+    std::uint32_t tilesOffsetFor(std::uint32_t platformCount) {
+        const std::uint32_t end = sizeof(BinaryLevelHeader) + platformCount * sizeof(BinaryPlatform);
+        return (end + TileAlignment - 1) / TileAlignment * TileAlignment;
+    }
+
+    void requireLittleEndian(const std::string& path) {
+        if constexpr (std::endian::native != std::endian::little) {
+            throw InvalidMapError("Binary levels are little-endian only: " + path);
+        }
+    }
+}
+
+void BinaryLevel::write(const LevelData& level, const std::string& path) {
+    requireLittleEndian(path);
+
+    BinaryLevelHeader header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.width = static_cast<std::uint32_t>(level.width);
+    header.height = static_cast<std::uint32_t>(level.height);
+    for (std::size_t i = 0; i < level.spawns.size(); ++i) {
+        header.spawns[i][0] = level.spawns[i].col;
+        header.spawns[i][1] = level.spawns[i].row;
+    }
+    header.platformCount = static_cast<std::uint32_t>(level.platforms.size());
+    header.tilesOffset = tilesOffsetFor(header.platformCount);
+    for (std::size_t t = 0; t < TileTypeCount; ++t) {
+        header.typeCounts[t] = level.typeCounts[t];
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw ResourceLoadError("Failed to create binary level: " + path);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& p : level.platforms) {
+        const BinaryPlatform bp{p.start.col, p.start.row, p.minCol, p.maxCol, p.speed, p.direction};
+        out.write(reinterpret_cast<const char*>(&bp), sizeof(bp));
+    }
+    const std::streamoff written = static_cast<std::streamoff>(sizeof(header) + level.platforms.size() * sizeof(BinaryPlatform));
+    const std::string padding(static_cast<std::size_t>(header.tilesOffset - written), '\0');
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    static_assert(sizeof(TileType) == 1, "tile array is written byte per tile");
+    out.write(reinterpret_cast<const char*>(level.tiles.data()), static_cast<std::streamsize>(level.tiles.size()));
+    if (!out) {
+        throw ResourceLoadError("Failed to write binary level: " + path);
+    }
+}
+
+MappedLevel BinaryLevel::map(const std::string& path) {
+    requireLittleEndian(path);
+
+    MappedLevel level;
+    level.file = MappedFile::openPrivate(path);
+    const std::byte* base = level.file.data();
+    const std::size_t size = level.file.size();
+
+    if (size < sizeof(BinaryLevelHeader)) {
+        throw InvalidMapError(path + ": file too small for a binary level");
+    }
+    BinaryLevelHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+        throw InvalidMapError(path + ": not a version " + std::to_string(Version) + " binary level");
+    }
+    if (header.width == 0 || header.height == 0 ||
+        header.width > static_cast<std::uint32_t>(LevelLoader::MaxDimension) ||
+        header.height > static_cast<std::uint32_t>(LevelLoader::MaxDimension) ||
+        header.platformCount > (size - sizeof(BinaryLevelHeader)) / sizeof(BinaryPlatform) ||
+        header.tilesOffset != tilesOffsetFor(header.platformCount)) {
+        throw InvalidMapError(path + ": corrupt binary level header");
+    }
+    const std::size_t tileCount = static_cast<std::size_t>(header.width) * header.height;
+    if (size < header.tilesOffset || size - header.tilesOffset < tileCount) {
+        throw InvalidMapError(path + ": truncated tile array");
+    }
+
+    level.width = static_cast<int>(header.width);
+    level.height = static_cast<int>(header.height);
+    for (std::size_t i = 0; i < level.spawns.size(); ++i) {
+        level.spawns[i] = GridPos{header.spawns[i][0], header.spawns[i][1]};
+    }
+    level.platforms.reserve(header.platformCount);
+    for (std::uint32_t i = 0; i < header.platformCount; ++i) {
+        BinaryPlatform bp;
+        std::memcpy(&bp, base + sizeof(BinaryLevelHeader) + i * sizeof(BinaryPlatform), sizeof(bp));
+        level.platforms.push_back(PlatformSpec{GridPos{bp.col, bp.row}, bp.minCol, bp.maxCol, bp.speed, bp.direction});
+    }
+    LevelLoader::checkLayout(level.width, level.height, level.spawns, level.platforms, path);
+    // o trecere peste octetii deja mapati: o valoare in afara TileType ar fi UB mai departe, iar
+    // numaratorile din header (monedele ramase) trebuie sa fie chiar cele din harta
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(base + header.tilesOffset);
+    for (std::size_t i = 0; i < tileCount; ++i) {
+        if (bytes[i] >= TileTypeCount) {
+            throw InvalidMapError(path + ": invalid tile value " + std::to_string(bytes[i]) + " at (" +
+                                  std::to_string(i % header.width) + ", " + std::to_string(i / header.width) + ")");
+        }
+        ++level.typeCounts[bytes[i]];
+    }
+    for (std::size_t t = 0; t < std::size(header.typeCounts); ++t) {
+        const std::uint64_t counted = t < TileTypeCount ? level.typeCounts[t] : 0;
+        if (header.typeCounts[t] != counted) {
+            throw InvalidMapError(path + ": tile counts in the header do not match the tile array");
+        }
+    }
+    // tile-urile raman in fisierul mapat (copy-on-write), deja verificate mai sus
+    level.tiles = reinterpret_cast<TileType*>(level.file.data() + header.tilesOffset);
+    return level;
+}
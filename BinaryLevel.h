@@ -0,0 +1,58 @@
+#ifndef OOP_BINARYLEVEL_H
+#define OOP_BINARYLEVEL_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Level.h"
+#include "MappedFile.h"
+
+// Format binar compilat (.fbwl), little-endian:
+//   [BinaryLevelHeader, 192 bytes][platformCount x BinaryPlatform][padding][width*height bytes TileType]
+// Tile-urile sunt exact vectorul row-major din Map, deci se folosesc direct din maparea fisierului.
+struct BinaryLevelHeader {
+    char magic[4];                 // "FBWL"
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::int32_t spawns[4][2];     // (col, row) in ordinea PlayerType
+    std::uint32_t platformCount;
+    std::uint32_t tilesOffset;     // de la inceputul fisierului, aliniat la 64
+    std::uint32_t reserved[2];
+    // numarul de tile-uri din fiecare TileType (restul pana la 16 sunt 0); map() le verifica pe tile-uri
+    std::uint64_t typeCounts[16];
+};
+static_assert(sizeof(BinaryLevelHeader) == 192, "binary level header layout changed");
+static_assert(TileTypeCount <= 16, "typeCounts has one slot per TileType");
+
+struct BinaryPlatform {
+    std::int32_t col, row, minCol, maxCol;
+    float speed;
+    std::int32_t direction;
+};
+static_assert(sizeof(BinaryPlatform) == 24, "binary platform layout changed");
+
+// Un nivel binar mapat: tiles indica in interiorul lui file (copy-on-write, modificabil)
+struct MappedLevel {
+    MappedFile file;
+    int width = 0;
+    int height = 0;
+    std::array<GridPos, 4> spawns{};
+    std::vector<PlatformSpec> platforms;
+    std::array<std::size_t, TileTypeCount> typeCounts{};
+    TileType* tiles = nullptr;
+};
+
+class BinaryLevel {
+public:
+    static constexpr std::uint32_t Version = 3;
+    static constexpr const char* Extension = ".fbwl";
+
+    // folosit de utilitarul levelc; arunca ResourceLoadError la erori de scriere
+    static void write(const LevelData& level, const std::string& path);
+    // valideaza header-ul, spawn-urile si platformele (aceleasi reguli ca LevelLoader) si mapeaza
+    // fisierul; tile-urile nu se copiaza, dar se citesc o data (valori si numaratori). Arunca InvalidMapError
+    static MappedLevel map(const std::string& path);
+};
+
+#endif // OOP_BINARYLEVEL_H
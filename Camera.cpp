@@ -0,0 +1,36 @@
+#include "Camera.h"
+#include "MathUtils.h"
+#include <cmath>
+
+Camera::Camera(const sf::Vector2f& viewSize)
+    : view(viewSize / 2.f, viewSize)
+{
+}
+
+sf::Vector2f Camera::clampedCenter(const sf::Vector2f& target, const sf::FloatRect& world) const {
+    const sf::Vector2f half = view.getSize() / 2.f;
+    sf::Vector2f c = target;
+    // pe axa pe care harta e mai mica decat fereastra, harta ramane centrata
+    if (world.width <= view.getSize().x) c.x = world.left + world.width / 2.f;
+    else c.x = clamp<float>(c.x, world.left + half.x, world.left + world.width - half.x);
+    if (world.height <= view.getSize().y) c.y = world.top + world.height / 2.f;
+    else c.y = clamp<float>(c.y, world.top + half.y, world.top + world.height - half.y);
+    return c;
+}
+
+void Camera::snapTo(const sf::FloatRect& focus, const sf::FloatRect& world) {
+    const sf::Vector2f target(focus.left + focus.width / 2.f, focus.top + focus.height / 2.f);
+    view.setCenter(clampedCenter(target, world));
+}
+
+void Camera::follow(const sf::FloatRect& focus, const sf::FloatRect& world, float dt) {
+    const sf::Vector2f target = clampedCenter({focus.left + focus.width / 2.f, focus.top + focus.height / 2.f}, world);
+    // apropiere exponentiala: aceeasi miscare indiferent de dt
+    const float t = (followRate > 0.f) ? 1.f - std::exp(-followRate * dt) : 1.f;
+    const sf::Vector2f current = view.getCenter();
+    view.setCenter(current + (target - current) * t);
+}
+
+sf::FloatRect Camera::visibleArea() const {
+    return sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize());
+}
@@ -0,0 +1,29 @@
+#ifndef OOP_CAMERA_H
+#define OOP_CAMERA_H
+
+#include <SFML/Graphics.hpp>
+
+// Camera care urmareste personajele: un sf::View de dimensiune fixa (fereastra),
+// centrat pe zona ocupata de jucatori si tinut in interiorul hartii.
+class Camera {
+private:
+    sf::View view;
+    // cat de repede ajunge camera din urma tinta (1/s); 0 = fara netezire
+    float followRate = 8.f;
+
+    sf::Vector2f clampedCenter(const sf::Vector2f& target, const sf::FloatRect& world) const;
+
+public:
+    explicit Camera(const sf::Vector2f& viewSize = {0.f, 0.f});
+
+    // muta camera instant pe tinta (la inceputul/resetarea nivelului)
+    void snapTo(const sf::FloatRect& focus, const sf::FloatRect& world);
+    // apropie camera de tinta, independent de framerate
+    void follow(const sf::FloatRect& focus, const sf::FloatRect& world, float dt);
+
+    const sf::View& getView() const { return view; }
+    // zona din lume vizibila prin camera, folosita pentru culling
+    sf::FloatRect visibleArea() const;
+};
+
+#endif // OOP_CAMERA_H
@@ -1,169 +1,102 @@
 #include "Character.h"
-#include <algorithm>
 #include <utility>
-#include "ResourceManager.h"
 
-void Character::initFallbackShape(const sf::Color& c, const sf::Vector2f& size) {
-    fallbackShape.setSize(size);
-    fallbackShape.setFillColor(c);
-    fallbackShape.setPosition(position);
-}
-
-Character::Character(const std::string& nm, const std::string& texturePath,
-                     const sf::Vector2f& pos, int lifeCount,
-                     const sf::Color& fallbackColor)
-    : name(nm), usingTexture(false), position(pos), velocity(0.f, 0.f),
-      lives(lifeCount), onGround(false)
+Character::Character(const std::string& nm, const sf::Vector2f& pos, int lifeCount,
+                     const sf::Vector2f& hitbox)
+    : name(nm)
 {
-    if (!texturePath.empty()) {
-        usingTexture = true;
-
-        // Preluam textura direct din Singleton
-        sf::Texture& managedTexture = ResourceManager<sf::Texture>::getInstance().getResource(texturePath);
-        sprite.setTexture(managedTexture);
-
-        if (managedTexture.getSize().y > 0) {
-            float factor = Tile::getSize() / static_cast<float>(managedTexture.getSize().y);
-            sprite.setScale(factor, factor);
-        }
-        sprite.setPosition(position);
-    } else {
-        usingTexture = false;
-        initFallbackShape(fallbackColor, {static_cast<float>(Tile::getSize()), static_cast<float>(Tile::getSize())});
-    }
+    local.position = pos;
+    local.size = hitbox;
+    local.lives = lifeCount;
 }
 
 Character::~Character() = default;
 
+void Character::writeState(const ActorStore::Actor& a) {
+    if (store) store->set(slot, a);
+    else local = a;
+}
+
+ActorStore::Id Character::attach(ActorStore& actors) {
+    ActorStore::Actor a = readState();
+    // elementul intra in store o singura data, bucla de coliziuni nu mai face apel virtual
+    a.element = element();
+    slot = actors.add(a);
+    store = &actors;
+    return slot;
+}
+
 void Character::setOnGround(bool state) {
-    onGround = state;
-    if (onGround) {
-        velocity.y = 0.f;
+    if (store) {
+        store->setOnGround(slot, state);
+        return;
+    }
+    local.onGround = state;
+    if (local.onGround) {
+        local.velocity.y = 0.f;
     }
 }
 
 Character::Character(const Character& other)
     : name(other.name),
-      sprite(other.sprite),
-      fallbackShape(other.fallbackShape),
-      usingTexture(other.usingTexture),
-      position(other.position),
-      velocity(other.velocity),
-      lives(other.lives),
-      onGround(other.onGround),
-      speed(other.speed),
-      jumpImpulse(other.jumpImpulse)
+      local(other.readState())
 {
 }
 
 Character& Character::operator=(const Character& other) {
     if (this == &other) return *this;
     name = other.name;
-    sprite = other.sprite;
-    fallbackShape = other.fallbackShape;
-    usingTexture = other.usingTexture;
-    position = other.position;
-    velocity = other.velocity;
-    lives = other.lives;
-    onGround = other.onGround;
-    speed = other.speed;
-    jumpImpulse = other.jumpImpulse;
+    writeState(other.readState());
     return *this;
 }
 
 void Character::swap(Character& other) noexcept {
     using std::swap;
     swap(name, other.name);
-    swap(sprite, other.sprite);
-    swap(fallbackShape, other.fallbackShape);
-    swap(usingTexture, other.usingTexture);
-    swap(position, other.position);
-    swap(velocity, other.velocity);
-    swap(lives, other.lives);
-    swap(onGround, other.onGround);
-    swap(speed, other.speed);
-    swap(jumpImpulse, other.jumpImpulse);
+    // se schimba starile, fiecare fatada ramane legata de actorul ei
+    const ActorStore::Actor mine = readState();
+    writeState(other.readState());
+    other.writeState(mine);
 }
 
 sf::FloatRect Character::bounds() const {
-    if (usingTexture) return sprite.getGlobalBounds();
-    return fallbackShape.getGlobalBounds();
+    return sf::FloatRect(getPosition(), getSize());
 }
 
 void Character::setPosition(const sf::Vector2f& p) {
-    position = p;
-    if (usingTexture) sprite.setPosition(position);
-    else fallbackShape.setPosition(position);
-}
-
-bool Character::update(float dt, const sf::FloatRect& worldBounds) {
-
-    const float maxStep = 0.02f;
-    float remaining = dt;
-    while (remaining > 0.f) {
-        float step = std::min(remaining, maxStep);
-        if (!onGround) velocity.y += GRAVITY * step;
-        position += velocity * step;
-
-        if (position.y + Tile::getSize() > worldBounds.top + worldBounds.height) {
-            position.y = worldBounds.top + worldBounds.height - Tile::getSize();
-            velocity.y = 0.f;
-            onGround = true;
-        } else {
-            onGround = false;
-        }
-
-        if (position.x < worldBounds.left) position.x = worldBounds.left;
-        if (position.x + Tile::getSize() > worldBounds.left + worldBounds.width)
-            position.x = worldBounds.left + worldBounds.width - Tile::getSize();
-
-        remaining -= step;
-    }
-
-    if (usingTexture) sprite.setPosition(position);
-    else fallbackShape.setPosition(position);
-    return true;
+    if (store) store->setPosition(slot, p);
+    else local.position = p;
 }
 
 void Character::moveLeft(float dt) {
-    position.x -= speed * dt;
-    if (usingTexture) sprite.setPosition(position); else fallbackShape.setPosition(position);
+    if (store) store->moveLeft(slot, dt);
+    else local.walk -= local.speed * dt;
 }
 
 void Character::moveRight(float dt) {
-    position.x += speed * dt;
-    if (usingTexture) sprite.setPosition(position); else fallbackShape.setPosition(position);
+    if (store) store->moveRight(slot, dt);
+    else local.walk += local.speed * dt;
 }
 
 void Character::jump() {
-    if (onGround) {
-        velocity.y = -jumpImpulse;
-        onGround = false;
+    if (store) {
+        store->jump(slot);
+    } else if (local.onGround) {
+        local.velocity.y = -local.jumpImpulse;
+        local.onGround = false;
     }
 }
 
 // takeDamageAndRespawn eliminata-direct game over de aici
 
-void Character::draw(sf::RenderTarget& target) const {
-    // NVI: interfață non-virtuală, delega la hook-ul virtual
-    drawImpl(target);
+void Character::stopVerticalMovement() {
+    if (store) store->stopVerticalMovement(slot);
+    else local.velocity.y = 0.f;
 }
 
-void Character::drawImpl(sf::RenderTarget& target) const {
-    if (usingTexture) target.draw(sprite);
-    else target.draw(fallbackShape);
-}
-
-void Character::setFallbackAppearance() {
-    fallbackShape.setFillColor(getDefaultFallbackColor());
-    fallbackShape.setSize({static_cast<float>(Tile::getSize()), static_cast<float>(Tile::getSize())});
-    fallbackShape.setPosition(position);
-}
-
-void Character::stopVerticalMovement() { velocity.y = 0.f; }
-
 void Character::print(std::ostream& os) const {
-    os << name << " pos=(" << (int)position.x << "," << (int)position.y << ") lives=" << lives;
+    const sf::Vector2f position = getPosition();
+    os << name << " pos=(" << (int)position.x << "," << (int)position.y << ") lives=" << getLives();
 }
 
 std::ostream& operator<<(std::ostream& os, const Character& c) {
@@ -1,76 +1,70 @@
 #ifndef OOP_CHARACTER_H
 #define OOP_CHARACTER_H
 
-#include <SFML/Graphics.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <memory>
 #include <utility>
 #include <string>
 #include <ostream>
-#include "Tile.h"
+#include "TileType.h"
+#include "CollisionRules.h"
+#include "ActorStore.h"
 
+// personajele jucabile; folosit de CharacterFactory si pentru arta din atlas
+enum class PlayerType { Fireboy, Watergirl, Earthboy, Airgirl };
 
-enum class Element { Fire, Water, Neutral, Air };
-
+// Fatada unui personaj: numele si comportamentul polimorfic (element, arta, clonare).
+// Starea fizica sta in ActorStore (structure-of-arrays) cat timp personajul e legat de unul
+// (in Simulation); un personaj nelegat (nou din fabrica, prototip, copie) isi tine starea local.
 class Character {
 private:
     std::string name;
-    sf::Sprite sprite;
-    sf::RectangleShape fallbackShape;
-    bool usingTexture{};
-    sf::Vector2f position{}; // coord globale (top-left)
-    sf::Vector2f velocity{};
-    int lives{0};
-    bool onGround{false};
-
-    float speed = 160.f; // px/s
-    float jumpImpulse = 435.f;
-    static constexpr float GRAVITY = 900.f;
+    ActorStore::Actor local;
+    ActorStore* store = nullptr;
+    ActorStore::Id slot = 0;
 
-    void initFallbackShape(const sf::Color& c, const sf::Vector2f& size);
+    ActorStore::Actor readState() const { return store ? store->get(slot) : local; }
+    void writeState(const ActorStore::Actor& a);
 
 public:
-    Character(const std::string& nm, const std::string& texturePath,
-              const sf::Vector2f& pos = {0.f,0.f}, int lifeCount = 3,
-              const sf::Color& fallbackColor = sf::Color::White);
+    Character(const std::string& nm, const sf::Vector2f& pos = {0.f,0.f}, int lifeCount = 3,
+              const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)});
     virtual ~Character();
 
-    // atribut polimorfic
+    // atribut polimorfic; alege randul din CollisionRules
     virtual Element element() const = 0;
+    // ce arta foloseste renderer-ul pentru personaj
+    virtual PlayerType playerType() const = 0;
 
     // constructor virtual pentru copiere polimorfa
     virtual std::unique_ptr<Character> clone() const = 0;
 
-    // interacțiuni polimorfice cu tile urile (evita if uri pe tipuri in game)
-    // implicit , un personaj neutru : doar Solid e solid, fire/water sunt letale
-    // by default niciun exit nu este potrivit, la half tiles partea de sus este letala pentru ambele
-    virtual bool isSolidOn(TileType tt) const {
-        return tt == TileType::Solid;
-    }
-    virtual bool isDeadlyOn(TileType tt) const {
-        return tt == TileType::Fire || tt == TileType::Water; // implicit ambele omoară
-    }
-
-    virtual bool canExitThrough(TileType) const { return false; }
-    virtual bool isTopHalfDeadly(TileType tt) const {
-        return tt == TileType::HalfFire || tt == TileType::HalfWater;
-    }
+    // interactiunile cu tile-urile (solid, letal, exit, monede) sunt in tabelul CollisionRules, dupa element()
 
-    // rule of 3
+    // rule of 3: copia e o valoare nelegata, cu starea de la momentul copierii
     Character(const Character& other);
     // clasa este abstracta
-    // folosim o varianta clasică prin const&
+    // folosim o varianta clasică prin const&; atribuirea scrie starea si in store daca e legat
     Character& operator=(const Character& other);
 
 
     void swap(Character& other) noexcept;
 
+    // muta starea locala in store (actor nou) si leaga fatada de el
+    ActorStore::Id attach(ActorStore& actors);
+    // leaga fatada de un actor existent (dupa copierea store-ului), fara a copia starea
+    void bind(ActorStore& actors, ActorStore::Id id) { store = &actors; slot = id; }
+    bool isAttached() const { return store != nullptr; }
+    ActorStore::Id actorId() const { return slot; }
 
     void setOnGround(bool state);
 
     // getters -pot fi neutilizati in unele build uri )
     [[maybe_unused]] const std::string& getName() const { return name; }
-    [[maybe_unused]] int getLives() const { return lives; }
-    [[maybe_unused]] sf::Vector2f getPosition() const { return position; }
+    [[maybe_unused]] int getLives() const { return readState().lives; }
+    [[maybe_unused]] sf::Vector2f getPosition() const { return store ? store->position(slot) : local.position; }
+    sf::Vector2f getSize() const { return store ? store->size(slot) : local.size; }
 
 
     sf::FloatRect bounds() const;
@@ -78,28 +72,17 @@ public:
 
     void setPosition(const sf::Vector2f& p);
 
-    // comportament
-    bool update(float dt, const sf::FloatRect& worldBounds);
+    // comportament (in Simulation, bucla de fizica lucreaza direct pe ActorStore)
     void moveLeft(float dt);
     void moveRight(float dt);
     void jump();
-    void draw(sf::RenderTarget& target) const;
 
-    void setFallbackAppearance();
     void stopVerticalMovement();
 
-
-    bool isUsingTexture() const { return usingTexture; }
-
     // afisare virtuala cu operator<<
     virtual void print(std::ostream& os) const;
 
     friend std::ostream& operator<<(std::ostream& os, const Character& c);
-protected:
-    // NVI pe randare: draw() public non-virtual va apela acest hook virtual
-    virtual void drawImpl(sf::RenderTarget& target) const;
-    // Each derived character specifies its own default fallback color (polymorphic)
-    virtual sf::Color getDefaultFallbackColor() const = 0;
 };
 
 // derivate
@@ -107,12 +90,12 @@ class FireboyCharacter : public Character {
 public:
     // constrctor explicit care apelează ctorul bazei
     FireboyCharacter(const std::string& nm,
-                     const std::string& texturePath,
                      const sf::Vector2f& pos = {0.f, 0.f},
                      int lifeCount = 3,
-                     const sf::Color& fallbackColor = sf::Color::White)
-        : Character(nm, texturePath, pos, lifeCount, fallbackColor) {}
+                     const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)})
+        : Character(nm, pos, lifeCount, hitbox) {}
     Element element() const override { return Element::Fire; }
+    PlayerType playerType() const override { return PlayerType::Fireboy; }
     std::unique_ptr<Character> clone() const override {
         return std::make_unique<FireboyCharacter>(*this);
     }
@@ -120,28 +103,18 @@ public:
         Character::print(os);
         os << " element=Fire";
     }
-    bool isSolidOn(TileType tt) const override {
-        return tt == TileType::Solid || tt == TileType::Fire;
-    }
-    bool isDeadlyOn(TileType tt) const override {
-        return tt == TileType::Water; // apa omoara focul
-    }
-    bool canExitThrough(TileType tt) const override { return tt == TileType::ExitFire; }
-    bool isTopHalfDeadly(TileType tt) const override { return tt == TileType::HalfWater; }
-protected:
-    sf::Color getDefaultFallbackColor() const override { return sf::Color::Red; }
 };
 
 class WatergirlCharacter : public Character {
 public:
     // ctor explicit care apeleaza ctorul bazei în lista de inițializare
     WatergirlCharacter(const std::string& nm,
-                       const std::string& texturePath,
                        const sf::Vector2f& pos = {0.f, 0.f},
                        int lifeCount = 3,
-                       const sf::Color& fallbackColor = sf::Color::White)
-        : Character(nm, texturePath, pos, lifeCount, fallbackColor) {}
+                       const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)})
+        : Character(nm, pos, lifeCount, hitbox) {}
     Element element() const override { return Element::Water; }
+    PlayerType playerType() const override { return PlayerType::Watergirl; }
     std::unique_ptr<Character> clone() const override {
         return std::make_unique<WatergirlCharacter>(*this);
     }
@@ -149,16 +122,6 @@ public:
         Character::print(os);
         os << " element=Water";
     }
-    bool isSolidOn(TileType tt) const override {
-        return tt == TileType::Solid || tt == TileType::Water;
-    }
-    bool isDeadlyOn(TileType tt) const override {
-        return tt == TileType::Fire; // focul omoara apa
-    }
-    bool canExitThrough(TileType tt) const override { return tt == TileType::ExitWater; }
-    bool isTopHalfDeadly(TileType tt) const override { return tt == TileType::HalfFire; }
-protected:
-    sf::Color getDefaultFallbackColor() const override { return sf::Color::Blue; }
 };
 
 
@@ -167,12 +130,12 @@ protected:
 class EarthboyCharacter : public Character {
 public:
     EarthboyCharacter(const std::string& nm,
-                      const std::string& texturePath,
                       const sf::Vector2f& pos = {0.f, 0.f},
                       int lifeCount = 3,
-                      const sf::Color& fallbackColor = sf::Color::Green)
-        : Character(nm, texturePath, pos, lifeCount, fallbackColor) {}
+                      const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)})
+        : Character(nm, pos, lifeCount, hitbox) {}
     Element element() const override { return Element::Neutral; }
+    PlayerType playerType() const override { return PlayerType::Earthboy; }
     std::unique_ptr<Character> clone() const override {
         return std::make_unique<EarthboyCharacter>(*this);
     }
@@ -180,22 +143,18 @@ public:
         Character::print(os);
         os << " element=Neutral(Earth)";
     }
-    // comportament neutru: doar solid e suport, lichidele omoara (moștenit)
-    bool canExitThrough(TileType tt) const override { return tt == TileType::ExitEarth; }
-protected:
-    sf::Color getDefaultFallbackColor() const override { return sf::Color::Green; }
 };
 
 // Airgirl e clasa derivata adaugata la final din baza character:
 class AirgirlCharacter : public Character {
 public:
     AirgirlCharacter(const std::string& nm,
-                     const std::string& texturePath,
                      const sf::Vector2f& pos = {0.f, 0.f},
                      int lifeCount = 3,
-                     const sf::Color& fallbackColor = sf::Color(220,220,255))
-        : Character(nm, texturePath, pos, lifeCount, fallbackColor) {}
+                     const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)})
+        : Character(nm, pos, lifeCount, hitbox) {}
     Element element() const override { return Element::Air; }
+    PlayerType playerType() const override { return PlayerType::Airgirl; }
     std::unique_ptr<Character> clone() const override {
         return std::make_unique<AirgirlCharacter>(*this);
     }
@@ -203,9 +162,6 @@ public:
         Character::print(os);
         os << " element=Air";
     }
-    bool canExitThrough(TileType tt) const override { return tt == TileType::ExitAir; }
-protected:
-    sf::Color getDefaultFallbackColor() const override { return sf::Color::White; }
 };
 
 #endif
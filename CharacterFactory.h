@@ -4,27 +4,34 @@
 #include "Character.h"
 #include <memory>
 #include <stdexcept>
-#include <SFML/Graphics.hpp>
-
-// Factory Method Pattern: create characters based on enum type
-enum class PlayerType { Fireboy, Watergirl, Earthboy, Airgirl };
+#include <SFML/System/Vector2.hpp>
 
+// Factory Method Pattern: create characters based on enum type (PlayerType)
 class CharacterFactory {
 public:
+    // hitbox-ul fiecarui personaj: inaltimea unui tile si latimea sprite-ului din atlas scalat la ea
+    // (arta e in assets/, dar simularea nu are nevoie de ea; actualizeaza aici daca se schimba imaginile)
+    static sf::Vector2f hitboxSize(PlayerType type) {
+        const float h = static_cast<float>(TileSize);
+        switch (type) {
+            case PlayerType::Fireboy: return {h * 73.f / 128.f, h};
+            case PlayerType::Watergirl: return {h * 95.f / 128.f, h};
+            case PlayerType::Earthboy: return {h * 85.f / 128.f, h};
+            case PlayerType::Airgirl: return {h * 64.f / 128.f, h};
+        }
+        return {h, h};
+    }
+
     static std::unique_ptr<Character> createCharacter(PlayerType type, const sf::Vector2f& spawnPos) {
         switch (type) {
             case PlayerType::Fireboy:
-                return std::make_unique<FireboyCharacter>(
-                    "Fireboy", "assets/fireboy1.png", spawnPos, 3, sf::Color::Red);
+                return std::make_unique<FireboyCharacter>("Fireboy", spawnPos, 3, hitboxSize(type));
             case PlayerType::Watergirl:
-                return std::make_unique<WatergirlCharacter>(
-                    "Watergirl", "assets/watergirl1.png", spawnPos, 3, sf::Color::Blue);
+                return std::make_unique<WatergirlCharacter>("Watergirl", spawnPos, 3, hitboxSize(type));
             case PlayerType::Earthboy:
-                return std::make_unique<EarthboyCharacter>(
-                    "Earthboy", "assets/earthboy.png", spawnPos, 3, sf::Color::Green);
+                return std::make_unique<EarthboyCharacter>("Earthboy", spawnPos, 3, hitboxSize(type));
             case PlayerType::Airgirl:
-                return std::make_unique<AirgirlCharacter>(
-                    "Airgirl", "assets/airgirl.png", spawnPos, 3, sf::Color(220,220,255));
+                return std::make_unique<AirgirlCharacter>("Airgirl", spawnPos, 3, hitboxSize(type));
             default:
                 throw std::invalid_argument("Unknown PlayerType provided to CharacterFactory");
         }
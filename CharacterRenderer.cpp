@@ -0,0 +1,45 @@
+#include "CharacterRenderer.h"
+#include "TextureAtlas.h"
+
+CharacterRenderer::CharacterRenderer() {
+    // imaginea personajului e o zona din atlasul comun (Singleton)
+    const TextureAtlas& atlas = TextureAtlas::getInstance();
+    for (PlayerType p : {PlayerType::Fireboy, PlayerType::Watergirl, PlayerType::Earthboy, PlayerType::Airgirl}) {
+        const sf::IntRect* region = atlas.regionFor(p);
+        if (!region || region->height <= 0) continue;
+        sf::Sprite& sprite = sprites[slot(p)];
+        sprite.setTexture(atlas.getTexture());
+        sprite.setTextureRect(*region);
+        hasTexture[slot(p)] = true;
+    }
+
+    // zona alba din atlas: forma colorata nu schimba textura legata fata de restul scenei
+    fallbackShape.setTexture(&atlas.getTexture());
+    fallbackShape.setTextureRect(atlas.solidColorRegion());
+}
+
+sf::Color CharacterRenderer::fallbackColorFor(PlayerType p) {
+    switch (p) {
+        case PlayerType::Fireboy: return sf::Color::Red;
+        case PlayerType::Watergirl: return sf::Color::Blue;
+        case PlayerType::Earthboy: return sf::Color::Green;
+        case PlayerType::Airgirl: return sf::Color::White;
+    }
+    return sf::Color::White;
+}
+
+void CharacterRenderer::draw(sf::RenderTarget& target, PlayerType p, const sf::FloatRect& b) {
+    if (hasTexture[slot(p)]) {
+        // sprite-ul acopera exact hitbox-ul personajului
+        sf::Sprite& sprite = sprites[slot(p)];
+        const sf::IntRect& tex = sprite.getTextureRect();
+        sprite.setScale(b.width / static_cast<float>(tex.width), b.height / static_cast<float>(tex.height));
+        sprite.setPosition(b.left, b.top);
+        target.draw(sprite);
+    } else {
+        fallbackShape.setSize({b.width, b.height});
+        fallbackShape.setFillColor(fallbackColorFor(p));
+        fallbackShape.setPosition(b.left, b.top);
+        target.draw(fallbackShape);
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef OOP_CHARACTERRENDERER_H
+#define OOP_CHARACTERRENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include "Character.h"
+
+// Aspectul personajelor: sprite-ul din atlas pentru fiecare PlayerType, sau un dreptunghi
+// colorat daca imaginea lipseste. Character ramane fara nimic de randare.
+class CharacterRenderer {
+private:
+    static constexpr std::size_t PlayerTypeCount = 4;
+
+    std::array<sf::Sprite, PlayerTypeCount> sprites;
+    std::array<bool, PlayerTypeCount> hasTexture{};
+    sf::RectangleShape fallbackShape;
+
+    static std::size_t slot(PlayerType p) { return static_cast<std::size_t>(p); }
+
+public:
+    CharacterRenderer();
+
+    // false daca imaginea personajului nu a putut fi incarcata in atlas
+    bool hasArt(PlayerType p) const { return hasTexture[slot(p)]; }
+    static sf::Color fallbackColorFor(PlayerType p);
+
+    // bounds: hitbox-ul personajului la pozitia interpolata intre tick-uri
+    void draw(sf::RenderTarget& target, PlayerType p, const sf::FloatRect& bounds);
+};
+
+#endif // OOP_CHARACTERRENDERER_H
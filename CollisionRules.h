@@ -0,0 +1,115 @@
+#ifndef OOP_COLLISIONRULES_H
+#define OOP_COLLISIONRULES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "TileType.h"
+
+// elementul personajului: alege randul din tabelul de coliziuni
+enum class Element : std::uint8_t { Fire, Water, Neutral, Air };
+inline constexpr std::size_t ElementCount = static_cast<std::size_t>(Element::Air) + 1;
+
+// Regulile de interactiune personaj-tile, calculate la compilare intr-un tabel [Element][TileType].
+// Bucla de coliziuni face o singura citire per tile in loc de apeluri virtuale si dynamic_cast;
+// un personaj nou inseamna un Element nou si un rand nou in rulesFor, nu metode suprascrise.
+class CollisionRules {
+public:
+    using Flags = std::uint8_t;
+
+    static constexpr Flags None = 0;
+    // tot tile-ul blocheaza personajul
+    static constexpr Flags Solid = 1u << 0;
+    // doar jumatatea de jos blocheaza (HalfFire/HalfWater, pentru toti)
+    static constexpr Flags BottomHalfSolid = 1u << 1;
+    // atingerea jumatatii de sus omoara personajul
+    static constexpr Flags TopHalfDeadly = 1u << 2;
+    // atingerea tile-ului omoara personajul
+    static constexpr Flags Deadly = 1u << 3;
+    // iesirea personajului
+    static constexpr Flags Exit = 1u << 4;
+    // moneda pe care personajul o poate colecta
+    static constexpr Flags CollectCoin = 1u << 5;
+
+    static constexpr Flags lookup(Element e, TileType t) {
+        return table[static_cast<std::size_t>(e)][static_cast<std::size_t>(t)];
+    }
+
+    // tipurile de tile care au cel putin unul din flags pentru elementul dat (pentru TileOccupancy)
+    static constexpr TileMask tilesWith(Element e, Flags flags) {
+        TileMask mask = 0;
+        for (std::size_t t = 0; t < TileTypeCount; ++t) {
+            if (lookup(e, static_cast<TileType>(t)) & flags) mask |= tileBit(static_cast<TileType>(t));
+        }
+        return mask;
+    }
+    // orice regula: tile-urile pe care bucla de coliziuni trebuie sa le viziteze
+    static constexpr Flags Any = Solid | BottomHalfSolid | TopHalfDeadly | Deadly | Exit | CollectCoin;
+    // tile-urile care opresc miscarea (obstacolele din swept AABB)
+    static constexpr Flags Blocking = Solid | BottomHalfSolid;
+
+private:
+    // sursa tabelului; evaluata doar la compilare
+    static constexpr Flags rulesFor(Element e, TileType t) {
+        switch (t) {
+            case TileType::Empty:
+                return None;
+            case TileType::Solid:
+                return Solid;
+            // lichidele: focul sta pe foc si moare in apa, apa invers; restul mor in ambele
+            case TileType::Fire:
+                if (e == Element::Fire) return Solid;
+                return Deadly;
+            case TileType::Water:
+                if (e == Element::Water) return Solid;
+                return Deadly;
+            // jumatatea de jos e solida pentru toti; cea de sus omoara pe cine nu e de acelasi element
+            case TileType::HalfFire:
+                return e == Element::Fire ? BottomHalfSolid : Flags(BottomHalfSolid | TopHalfDeadly);
+            case TileType::HalfWater:
+                return e == Element::Water ? BottomHalfSolid : Flags(BottomHalfSolid | TopHalfDeadly);
+            case TileType::Coin:
+                return CollectCoin;
+            case TileType::FireCoin:
+                return e == Element::Fire ? CollectCoin : None;
+            case TileType::WaterCoin:
+                return e == Element::Water ? CollectCoin : None;
+            case TileType::EarthCoin:
+                return e == Element::Neutral ? CollectCoin : None;
+            case TileType::ExitFire:
+                return e == Element::Fire ? Exit : None;
+            case TileType::ExitWater:
+                return e == Element::Water ? Exit : None;
+            case TileType::ExitEarth:
+                return e == Element::Neutral ? Exit : None;
+            case TileType::ExitAir:
+                return e == Element::Air ? Exit : None;
+        }
+        return None;
+    }
+
+    using Table = std::array<std::array<Flags, TileTypeCount>, ElementCount>;
+
+    static constexpr Table buildTable() {
+        Table result{};
+        for (std::size_t e = 0; e < ElementCount; ++e) {
+            for (std::size_t t = 0; t < TileTypeCount; ++t) {
+                result[e][t] = rulesFor(static_cast<Element>(e), static_cast<TileType>(t));
+            }
+        }
+        return result;
+    }
+
+    // definit dupa clasa: buildTable trebuie sa fie complet la evaluare
+    static const Table table;
+};
+
+inline constexpr CollisionRules::Table CollisionRules::table = CollisionRules::buildTable();
+
+// regulile vechilor metode virtuale, verificate la compilare
+static_assert(CollisionRules::lookup(Element::Fire, TileType::Fire) == CollisionRules::Solid);
+static_assert(CollisionRules::lookup(Element::Neutral, TileType::Water) == CollisionRules::Deadly);
+static_assert(CollisionRules::lookup(Element::Air, TileType::EarthCoin) == CollisionRules::None);
+static_assert(CollisionRules::tilesWith(Element::Fire, CollisionRules::Solid) == (tileBit(TileType::Solid) | tileBit(TileType::Fire)));
+
+#endif // OOP_COLLISIONRULES_H
@@ -0,0 +1,37 @@
+#ifndef OOP_FIXEDTIMESTEP_H
+#define OOP_FIXEDTIMESTEP_H
+
+#include <algorithm>
+
+// Acumulator pentru bucla cu pas fix: timpul real al frame-urilor se transforma in
+// tick-uri intregi de simulare, iar restul ramas (alpha) e folosit la interpolarea desenarii.
+class FixedTimestep {
+private:
+    double tickSeconds;
+    double accumulator = 0.0;
+    // dupa o pauza lunga (fereastra trasa, breakpoint) nu se recupereaza mai mult de atat,
+    // altfel simularea ar ramane mereu in urma ("spiral of death")
+    static constexpr double MaxFrameSeconds = 0.25;
+
+public:
+    explicit FixedTimestep(double tickSecs) : tickSeconds(tickSecs) {}
+
+    // adauga timpul unui frame si intoarce cate tick-uri trebuie rulate acum
+    int advance(double frameSeconds) {
+        accumulator += std::clamp(frameSeconds, 0.0, MaxFrameSeconds);
+        int ticks = 0;
+        while (accumulator >= tickSeconds) {
+            accumulator -= tickSeconds;
+            ++ticks;
+        }
+        return ticks;
+    }
+
+    // cat din urmatorul tick a trecut deja, in [0,1): 0 = starea anterioara, 1 = starea curenta
+    float alpha() const { return static_cast<float>(accumulator / tickSeconds); }
+
+    // la pornirea/restartul nivelului: fara timp ramas din frame-urile anterioare
+    void reset() { accumulator = 0.0; }
+};
+
+#endif // OOP_FIXEDTIMESTEP_H
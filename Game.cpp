@@ -2,156 +2,34 @@
 #include "GameExceptions.h"
 #include "MathUtils.h"
 #include "ResourceManager.h"
-#include "CharacterFactory.h"
+#include "TextureAtlas.h"
 #include <iostream>
 #include <utility>
 #include <algorithm>
 
-namespace {
-    inline bool intersects(const sf::FloatRect& a, const sf::FloatRect& b) {
-        return a.intersects(b);
-    }
-
-    inline void resolveCollision(Character& ch, sf::FloatRect& cb, const sf::FloatRect& rect) {
-        float charCenterX = cb.left + cb.width * 0.5f;
-        float rectCenterX = rect.left + rect.width * 0.5f;
-        float charCenterY = cb.top + cb.height * 0.5f;
-        float rectCenterY = rect.top + rect.height * 0.5f;
-
-        float dx = charCenterX - rectCenterX;
-        float dy = charCenterY - rectCenterY;
-
-        float intersectX = (cb.width + rect.width) * 0.5f - std::abs(dx);
-        float intersectY = (cb.height + rect.height) * 0.5f - std::abs(dy);
-
-        if (intersectX > 0.0f && intersectY > 0.0f) {
-            if (intersectX < intersectY) {
-                // Lateral/Horizontal resolution
-                if (dx > 0.0f) {
-                    ch.setPosition({rect.left + rect.width, cb.top});
-                } else {
-                    ch.setPosition({rect.left - cb.width, cb.top});
-                }
-            } else {
-                // Vertical resolution
-                if (dy > 0.0f) {
-                    ch.setPosition({cb.left, rect.top + rect.height});
-                    ch.stopVerticalMovement();
-                } else {
-                    ch.setPosition({cb.left, rect.top - cb.height});
-                    ch.setOnGround(true);
-                }
-            }
-            cb = ch.bounds();
-        }
-    }
-}
-
-void Game::initializeCharacters() {
-    // clear all containers
-    characters.clear();
-    characterPrototypes.clear();
-    charactersAtExit.clear();
-    spawnPositions.clear();
-    characterControls.clear();
-
-    // Demonstrate template class instantiation for textures
-    ResourceManager<sf::Texture>::getInstance().getResource("assets/fireboy1.png");
-
-    // 1) Fireboy
-    {
-        sf::Vector2f spawn = map.respawnWorldPosForFire();
-        auto fb = CharacterFactory::createCharacter(PlayerType::Fireboy, spawn);
-        if (!fb->isUsingTexture()) {
-            throw ResourceLoadError("Failed to load mandatory asset: assets/fireboy1.png");
-        }
-        fb->setFallbackAppearance();
-        spawnPositions.push_back(spawn);
-        characters.push_back(std::move(fb));
-        charactersAtExit.push_back(false);
-        characterControls.push_back(Controls{sf::Keyboard::A, sf::Keyboard::D, sf::Keyboard::W});
-    }
-
-    // 2) Watergirl
-    {
-        sf::Vector2f spawn = map.respawnWorldPosForWater();
-        auto wg = CharacterFactory::createCharacter(PlayerType::Watergirl, spawn);
-        if (!wg->isUsingTexture()) {
-            throw ResourceLoadError("Failed to load mandatory asset: assets/watergirl1.png");
-        }
-        wg->setFallbackAppearance();
-        spawnPositions.push_back(spawn);
-        characters.push_back(std::move(wg));
-        charactersAtExit.push_back(false);
-        characterControls.push_back(Controls{sf::Keyboard::F, sf::Keyboard::H, sf::Keyboard::T});
-    }
-
-    // 3) Earthboy
-    {
-        sf::Vector2f spawn = map.respawnWorldPosForEarth();
-        auto eb = CharacterFactory::createCharacter(PlayerType::Earthboy, spawn);
-        if (!eb->isUsingTexture()) {
-            throw ResourceLoadError("Failed to load mandatory asset: assets/earthboy.png");
-        }
-        eb->setFallbackAppearance();
-        spawnPositions.push_back(spawn);
-        characters.push_back(std::move(eb));
-        charactersAtExit.push_back(false);
-        characterControls.push_back(Controls{sf::Keyboard::J, sf::Keyboard::L, sf::Keyboard::I});
-    }
-
-    // 4) Airgirl
-    {
-        sf::Vector2f spawn = map.respawnWorldPosForAir();
-        auto ag = CharacterFactory::createCharacter(PlayerType::Airgirl, spawn);
-        if (!ag->isUsingTexture()) {
-            throw ResourceLoadError("Failed to load mandatory asset: assets/airgirl.png");
-        }
-        ag->setFallbackAppearance();
-        spawnPositions.push_back(spawn);
-        characters.push_back(std::move(ag));
-        charactersAtExit.push_back(false);
-        characterControls.push_back(Controls{sf::Keyboard::Z, sf::Keyboard::C, sf::Keyboard::X});
-    }
-
-    // fill prototypes by cloning active characters
-    for (const auto& ch : characters) {
-        if (ch) characterPrototypes.push_back(ch->clone());
-        else characterPrototypes.push_back(nullptr);
-    }
-}
-
-
 Game::Game(const Game& other)
-    : map(other.map),
-      won(other.won),
-      gameOver(other.gameOver),
-      totalCoins(other.totalCoins),
-      collectedCoins(other.collectedCoins),
+    : sim(other.sim),
+      renderMap(other.renderMap),
+      renderEpoch(other.renderEpoch),
+      appliedTileEdits(other.appliedTileEdits),
+      renderTileRevision(other.renderTileRevision),
+      camera(other.camera),
+      characterControls(other.characterControls),
+      recordPath(other.recordPath),
+      recording(other.recording),
+      currentLevel(other.currentLevel),
       winFont(other.winFont),
       winText(other.winText),
       winFontLoaded(other.winFontLoaded),
       loseText(other.loseText)
 {
-    unsigned int wPx = static_cast<unsigned>(map.getWidth() * Tile::getSize());
-    unsigned int hPx = static_cast<unsigned>(map.getHeight() * Tile::getSize());
-    window = std::make_unique<sf::RenderWindow>(sf::VideoMode(wPx, hPx), "Fireboy & Watergirl");
-
-    // deep copy vectors
-    characters.clear();
-    characterPrototypes.clear();
-    charactersAtExit = other.charactersAtExit;
-    spawnPositions = other.spawnPositions;
-    characterControls = other.characterControls;
-
-    for (const auto& ch : other.characters) {
-        if (ch) characters.push_back(ch->clone());
-        else characters.push_back(nullptr);
-    }
-    for (const auto& proto : other.characterPrototypes) {
-        if (proto) characterPrototypes.push_back(proto->clone());
-        else characterPrototypes.push_back(nullptr);
-    }
+    // fereastra noua are dimensiunea camerei, nu a hartii
+    const sf::Vector2f viewSize = camera.getView().getSize();
+    window = std::make_unique<sf::RenderWindow>(
+        sf::VideoMode(static_cast<unsigned>(viewSize.x), static_cast<unsigned>(viewSize.y)), "Fireboy & Watergirl");
+
+    window->setKeyRepeatEnabled(false);
+    window->setFramerateLimit(MaxFrameRate);
 
     if (winFontLoaded) {
         winText.setFont(winFont);
@@ -165,190 +43,108 @@ Game& Game::operator=(Game other) {
     return *this;
 }
 
-void Game::processInput(float dt) {
-    if (!window) return;
-
-
-    if (won || gameOver) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::R)) {
-            resetLevel();
-        }
+void Game::handleKeyEvent(sf::Keyboard::Key key, bool pressed, double time) {
+    if (!simThread) return;
+    if (key == sf::Keyboard::R) {
+        if (pressed && levelEnded) resetLevel();
         return;
     }
-
-    // generic controls processing for all characters
-    const size_t n = std::min(characterControls.size(), characters.size());
-    for (size_t i = 0; i < n; ++i) {
-        if (!characters[i]) continue;
+    if (key == sf::Keyboard::Backspace) {
+        simThread->setRewinding(pressed);
+        return;
+    }
+#ifdef FBWG_PROFILER
+    if (key == sf::Keyboard::F3) {
+        if (pressed) profilerOverlay.toggle();
+        return;
+    }
+#endif
+    // o tasta poate apartine mai multor personaje; fiecare primeste evenimentul
+    for (size_t i = 0; i < characterControls.size(); ++i) {
         const Controls& ctl = characterControls[i];
-        if (sf::Keyboard::isKeyPressed(ctl.left)) characters[i]->moveLeft(dt);
-        if (sf::Keyboard::isKeyPressed(ctl.right)) characters[i]->moveRight(dt);
-        if (sf::Keyboard::isKeyPressed(ctl.jump)) characters[i]->jump();
+        const std::pair<sf::Keyboard::Key, InputAction> bindings[] = {
+            {ctl.left, InputAction::Left}, {ctl.right, InputAction::Right}, {ctl.jump, InputAction::Jump}};
+        for (const auto& [bound, action] : bindings) {
+            if (bound != key) continue;
+            if (!simThread->pushInput(InputEvent{time, static_cast<std::uint8_t>(i), action, pressed})) {
+                std::cerr << "Input queue full, dropped a key event\n";
+            }
+        }
     }
 }
 
-bool Game::handleCollisions(Character& ch) {
-    bool reachedExitForCharacter = false;
-    sf::FloatRect cb = ch.bounds();
-    int maxCol = map.getWidth() - 1;
-    int maxRow = map.getHeight() - 1;
-    int leftCol = clamp<int>(static_cast<int>(cb.left / Tile::getSize()), 0, maxCol);
-    int rightCol = clamp<int>(static_cast<int>((cb.left + cb.width) / Tile::getSize()), 0, maxCol);
-    int topRow = clamp<int>(static_cast<int>(cb.top / Tile::getSize()), 0, maxRow);
-    int bottomRow = clamp<int>(static_cast<int>((cb.top + cb.height) / Tile::getSize()), 0, maxRow);
-
-    for (int r = topRow; r <= bottomRow; ++r) {
-        for (int c = leftCol; c <= rightCol; ++c) {
-            TileType tt = map.getTileTypeAtGrid(c, r);
-
-            // tratare solida pe baza polimorfismului
-            if (ch.isSolidOn(tt)) {
-                sf::FloatRect tileRect(c * Tile::getSize(), r * Tile::getSize(), Tile::getSize(), Tile::getSize());
-                if (intersects(cb, tileRect)) {
-                    resolveCollision(ch, cb, tileRect);
-                }
-            }
-
-//tratare speciala pt half fire si half water
-            if (tt == TileType::HalfFire || tt == TileType::HalfWater) {
-                sf::FloatRect tileRect(c * Tile::getSize(), r * Tile::getSize(), Tile::getSize(), Tile::getSize());
-                const float halfH = Tile::getSize() * 0.5f;
-                sf::FloatRect topRect(tileRect.left, tileRect.top, tileRect.width, halfH);
-                sf::FloatRect bottomRect(tileRect.left, tileRect.top + halfH, tileRect.width, halfH);
-
-                // partea de jos e solida pt toti
-                if (intersects(cb, bottomRect)) {
-                    resolveCollision(ch, cb, bottomRect);
-                }
-
-
-                if (intersects(cb, topRect)) { //partea de sus este letala/ok
-                    if (ch.isTopHalfDeadly(tt)) {
-                        gameOver = true;
-
-                        return false;
-                    }
-                }
-            }
-
-            // moneda-zona activa e mijlocul jumatatii superioare
-            if (tt == TileType::Coin || tt == TileType::FireCoin || tt == TileType::WaterCoin || tt == TileType::EarthCoin) {
-                sf::FloatRect tileRect(c * Tile::getSize(), r * Tile::getSize(), Tile::getSize(), Tile::getSize());
-                const float halfH = Tile::getSize() * 0.5f;
-                const float quarterW = Tile::getSize() * 0.25f;
-                sf::FloatRect coinRect(tileRect.left + quarterW, tileRect.top,
-                                       Tile::getSize() * 0.5f, halfH);
-                if (intersects(cb, coinRect)) {
-                    // colectare conditionata de tipul jucatorului- downcast
-                    bool canCollect = false;
-                    if (tt == TileType::Coin) {
-
-                        canCollect = true;
-                    } else if (tt == TileType::FireCoin) {
-                        const auto* asFire = dynamic_cast<const FireboyCharacter*>(&ch);
-                        canCollect = (asFire != nullptr);
-                    } else if (tt == TileType::WaterCoin) {
-                        const auto* asWater = dynamic_cast<const WatergirlCharacter*>(&ch);
-                        canCollect = (asWater != nullptr);
-                    } else if (tt == TileType::EarthCoin) {
-                        const auto* asEarth = dynamic_cast<const EarthboyCharacter*>(&ch);
-                        canCollect = (asEarth != nullptr);
-                    }
-                    if (canCollect) {
-                        collectedCoins++;
-                        map.setTileTypeAtGrid(c, r, TileType::Empty);
-                    }
-
-                }
-            }
-
-            if (ch.isDeadlyOn(tt)) {
-   //a atins un tile letal=> game over
-                gameOver = true;
-
-                return false;
-            }
-
-            if (ch.canExitThrough(tt)) {
-                sf::FloatRect tileRect(c * Tile::getSize(), r * Tile::getSize(), Tile::getSize(), Tile::getSize());
-                if (intersects(cb, tileRect)) reachedExitForCharacter = true;
-            }
+void Game::releaseAllKeys(double time) {
+    if (!simThread) return;
+    simThread->setRewinding(false);
+    for (size_t i = 0; i < characterControls.size(); ++i) {
+        for (const InputAction action : {InputAction::Left, InputAction::Right, InputAction::Jump}) {
+            simThread->pushInput(InputEvent{time, static_cast<std::uint8_t>(i), action, false});
         }
     }
+}
 
-    //  also handle miscarea platformei
-    handlePlatformCollisions(ch);
-    return reachedExitForCharacter;
+void Game::recordInputLatency(const WorldSnapshot& snapshot) {
+    if (snapshot.latestInputTime <= lastShownInputTime) return;
+    lastShownInputTime = snapshot.latestInputTime;
+    const double latency = SimulationThread::now() - snapshot.latestInputTime;
+    inputLatency.last = latency;
+    inputLatency.max = std::max(inputLatency.max, latency);
+    inputLatency.total += latency;
+    ++inputLatency.samples;
 }
 
-void Game::update(float dt) {
-    if (won || gameOver) { // still keep HUD updated
-        gameHud.update(currentLevel, collectedCoins, totalCoins);
-        return;
+void Game::syncRenderMap(const WorldSnapshot& snapshot) {
+    if (snapshot.levelEpoch != renderEpoch) {
+        // restart: harta revine la starea de dupa incarcare, camera sare direct la personaje
+        renderMap.restorePristine();
+        appliedTileEdits = 0;
+        renderEpoch = snapshot.levelEpoch;
+        renderTileRevision = snapshot.tileEditsRevision;
+        camera.snapTo(snapshot.charactersFocus(1.f), renderMap.worldBounds());
+    } else if (snapshot.tileEditsRevision != renderTileRevision) {
+        // rewind peste o moneda luata: harta se reface din lista scurtata, camera ramane pe loc
+        renderMap.restorePristine();
+        appliedTileEdits = 0;
+        renderTileRevision = snapshot.tileEditsRevision;
+    }
+    // lista creste doar in cadrul unui nivel: se aplica doar ce e nou
+    for (; appliedTileEdits < snapshot.tileEdits.size(); ++appliedTileEdits) {
+        const TileEdit& e = snapshot.tileEdits[appliedTileEdits];
+        renderMap.setTileTypeAtGrid(e.col, e.row, e.type);
     }
+}
 
-    map.update(dt);
-    sf::FloatRect world = map.worldBounds();
-
-    // reset exit flags
-    charactersAtExit.assign(characters.size(), false);
+void Game::render(const WorldSnapshot& snapshot, float alpha, float frameDt) {
+    if (!window) return;
+    window->clear(sf::Color(40,40,40));
 
-    // update movement/physics
-    for (auto& ch : characters) {
-        if (ch) ch->update(dt, world);
+    // camera e doar prezentare: urmareste pozitiile interpolate, cu timpul real al frame-ului
+    if (!snapshot.won && !snapshot.gameOver) {
+        camera.follow(snapshot.charactersFocus(alpha), renderMap.worldBounds(), frameDt);
     }
 
-    // collisions and exits/coins
-    for (size_t i = 0; i < characters.size(); ++i) {
-        if (!characters[i]) continue;
-        charactersAtExit[i] = handleCollisions(*characters[i]);
+    // lumea prin camera: se deseneaza doar ce intersecteaza view-ul
+    window->setView(camera.getView());
+    const sf::FloatRect visible = camera.visibleArea();
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::MapDraw);
+        mapRenderer.draw(*window, renderMap, snapshot, alpha);
     }
-
-    // win condition: all at exit and coins collected
-    if (!charactersAtExit.empty()) {
-        bool allAtExit = std::all_of(charactersAtExit.begin(), charactersAtExit.end(), [](bool v){ return v; });
-        if (allAtExit && collectedCoins >= totalCoins) {
-            won = true;
+    for (std::size_t i = 0; i < snapshot.characters.size(); ++i) {
+        const sf::FloatRect bounds(snapshot.position(i, alpha), snapshot.characters[i].size);
+        if (bounds.intersects(visible)) {
+            characterRenderer.draw(*window, snapshot.characters[i].type, bounds);
         }
     }
 
-    // update HUD at the end
-    gameHud.update(currentLevel, collectedCoins, totalCoins);
-}
-
-void Game::handlePlatformCollisions(Character& ch) {
-
-    sf::FloatRect cb = ch.bounds();
-    for (const auto& mp : map.getMovingPlatforms()) {
-        sf::FloatRect pb = mp.bounds();
-        if (cb.intersects(pb)) {
-            resolveCollision(ch, cb, pb);
-        } else {
-            // CARRY minimal
-            const float epsilon = 1.5f;
-            bool horizontally = (cb.left < pb.left + pb.width) && (cb.left + cb.width > pb.left);
-            bool onTop = std::abs((cb.top + cb.height) - pb.top) <= epsilon;
-            if (horizontally && onTop) {
-                sf::Vector2f newPos = {cb.left + mp.getLastDeltaX(), cb.top};
-                ch.setPosition(newPos);
-                cb = ch.bounds();
-            }
-        }// CARRY
-    }
-}
-
-void Game::render() {
-    if (!window) return;
-    window->clear(sf::Color(40,40,40));
-    map.draw(*window);
-    for (const auto& ch : characters) {
-        if (ch) ch->draw(*window);
-    }
+    // HUD si ecranele de final sunt in coordonate de fereastra
+    window->setView(window->getDefaultView());
 
     // Render HUD before overlays
+    gameHud.update(snapshot.level, snapshot.collectedCoins, snapshot.totalCoins);
     gameHud.render(*window);
 
-    if (won) {
+    if (snapshot.won) {
 
         sf::RectangleShape overlay;
         overlay.setSize(sf::Vector2f(static_cast<float>(window->getSize().x), static_cast<float>(window->getSize().y)));
@@ -368,7 +164,7 @@ void Game::render() {
         }
     }
 
-    if (gameOver) {
+    if (snapshot.gameOver) {
 
         sf::RectangleShape overlay;
         overlay.setSize(sf::Vector2f(static_cast<float>(window->getSize().x), static_cast<float>(window->getSize().y)));
@@ -385,23 +181,44 @@ void Game::render() {
             window->setTitle("TRY AGAIN!");
         }
     }
-    window->display();
+#ifdef FBWG_PROFILER
+    profilerOverlay.update(inputLatency.last, inputLatency.mean());
+    profilerOverlay.render(*window);
+#endif
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::Display);
+        window->display();
+    }
+    FBWG_PROFILE_COMMIT(ProfilePhase::MapDraw, ProfilePhase::Display);
 }
 
-Game::Game(int mapW, int mapH)
+Game::Game(int viewCols, int viewRows, int tickRate)
     : window(std::make_unique<sf::RenderWindow>(
-          sf::VideoMode(static_cast<unsigned>(mapW * Tile::getSize()),
-                        static_cast<unsigned>(mapH * Tile::getSize())),
+          sf::VideoMode(static_cast<unsigned>(viewCols * Tile::getSize()),
+                        static_cast<unsigned>(viewRows * Tile::getSize())),
           "Fireboy & Watergirl")),
-      map(mapW, mapH)
+      sim(viewCols, viewRows, tickRate),
+      camera(sf::Vector2f(static_cast<float>(viewCols * Tile::getSize()),
+                          static_cast<float>(viewRows * Tile::getSize())))
 {
     if (!window->isOpen()) {
         throw WindowCreationError("Failed to create SFML window. Ensure a display is available and SFML is configured correctly.");
     }
+    // fiecare apasare e un singur KeyPressed; tinerea tastei o urmareste InputTimeline
+    window->setKeyRepeatEnabled(false);
+    window->setFramerateLimit(MaxFrameRate);
 
     // Start in Menu state; level will be loaded via startLevel() after selection
     state = GameState::Menu;
 
+    // mapare controale, in ordinea personajelor din Simulation (Fireboy, Watergirl, Earthboy, Airgirl)
+    characterControls = {
+        Controls{sf::Keyboard::A, sf::Keyboard::D, sf::Keyboard::W},
+        Controls{sf::Keyboard::F, sf::Keyboard::H, sf::Keyboard::T},
+        Controls{sf::Keyboard::J, sf::Keyboard::L, sf::Keyboard::I},
+        Controls{sf::Keyboard::Z, sf::Keyboard::C, sf::Keyboard::X},
+    };
+
     // Load font using ResourceManager (Singleton template)
     {
         sf::Font& font = ResourceManager<sf::Font>::getInstance().getResource("assets/arial.ttf");
@@ -427,6 +244,9 @@ Game::Game(int mapW, int mapH)
 
         // Initialize HUD using the loaded font
         gameHud.init(font, window->getSize().x);
+#ifdef FBWG_PROFILER
+        profilerOverlay.init(font, window->getSize().x, gameHud.barHeight());
+#endif
 
         // Initialize menu buttons (four level buttons centered on screen)
         const float btnWidth = 200.f;
@@ -472,106 +292,122 @@ Game::Game(int mapW, int mapH)
 }
 
 void Game::resetLevel() {
-    // regenerare harta si resetare
-    map.loadLevel(currentLevel);
-    totalCoins = 0;
-    collectedCoins = 0;
-    for (int rr = 0; rr < map.getHeight(); ++rr) {
-        for (int cc = 0; cc < map.getWidth(); ++cc) {
-            TileType t = map.getTileTypeAtGrid(cc, rr);
-            if (t == TileType::Coin || t == TileType::FireCoin || t == TileType::WaterCoin || t == TileType::EarthCoin) totalCoins++;
-        }
-    }
-
-    //rebuild
-    characters.clear();
-    for (const auto& proto : characterPrototypes) {
-        if (proto) characters.push_back(proto->clone());
-        else characters.push_back(nullptr);
-    }
-    // reset
-    for (size_t i = 0; i < characters.size(); ++i) {
-        if (!characters[i]) continue;
-        if (i < spawnPositions.size()) characters[i]->setPosition(spawnPositions[i]);
-        // fallback restructurat
-        characters[i]->setFallbackAppearance();
-    }
-
-    // reset flags
-    won = false;
-    gameOver = false;
-    charactersAtExit.assign(characters.size(), false);
+    // restartul il face firul simularii; camera sare cand apare snapshot-ul noului levelEpoch
+    if (simThread) simThread->requestRestart();
 }
 
 std::ostream& operator<<(std::ostream& os, const Game& g) {
-    os << "Game state:\n";
-    os << "Map: " << g.map.getWidth() << "x" << g.map.getHeight() << "\n";
-    for (size_t i = 0; i < g.characters.size(); ++i) {
-        if (g.characters[i]) os << "Character[" << i << "]: " << *g.characters[i] << "\n";
-    }
+    os << "Game state:\n" << g.sim;
     return os;
 }
 
 void Game::run() {
     sf::Clock clock;
     while (window && window->isOpen()) {
-        sf::Event ev;
-        while (window->pollEvent(ev)) {
-            if (ev.type == sf::Event::Closed)
-                window->close();
+        // o copie a unui Game aflat in joc isi porneste aici firul, inainte sa primeasca taste
+        if (state == GameState::Playing && !simThread) startSimThread();
+
+        {
+            FBWG_PROFILE_SCOPE(ProfilePhase::Input);
+            sf::Event ev;
+            while (window->pollEvent(ev)) {
+                // SFML nu da momentul evenimentului: se ia la citire, pe ceasul snapshot-urilor
+                const double eventTime = SimulationThread::now();
+                if (ev.type == sf::Event::Closed) {
+                    window->close();
+                } else if (ev.type == sf::Event::KeyPressed || ev.type == sf::Event::KeyReleased) {
+                    const bool pressed = ev.type == sf::Event::KeyPressed;
+                    if (state == GameState::Menu) {
+                        if (pressed) handleMenuKey(ev.key.code);
+                    } else {
+                        handleKeyEvent(ev.key.code, pressed, eventTime);
+                    }
+                } else if (ev.type == sf::Event::LostFocus && state == GameState::Playing) {
+                    releaseAllKeys(eventTime);
+                }
+            }
         }
-        float dt = clock.restart().asSeconds();
-        // Clamp dt to avoid large spikes (e.g., when dragging the window) that can cause physics tunneling
-        dt = clamp<float>(dt, 0.0f, 0.05f);
+        FBWG_PROFILE_COMMIT(ProfilePhase::Input, ProfilePhase::Input);
+        // timpul real al frame-ului nu mai intra in fizica: tick-urile le numara firul simularii
+        const float frameDt = clock.restart().asSeconds();
         if (state == GameState::Menu) {
             processMenuInput();
             renderMenu();
         } else {
-            processInput(dt);
-            update(dt);
-            render(); //-fix eroare la dragging ul ferestrei
+            const WorldSnapshot& snapshot = simThread->latest();
+            syncRenderMap(snapshot);
+            levelEnded = snapshot.won || snapshot.gameOver;
+            // cat din tick-ul urmator a trecut de cand s-a atins starea din snapshot
+            const double sinceTick = SimulationThread::now() - snapshot.tickTime;
+            // la rewind tick-urile merg inapoi: interpolarea intre ele ar face pozitiile sa tremure
+            const float alpha = snapshot.rewinding ? 1.0f
+                : clamp<float>(static_cast<float>(sinceTick / snapshot.tickDt), 0.0f, 1.0f);
+            // camera limitata ca inainte, ca sa nu sara dupa o pauza lunga
+            render(snapshot, alpha, clamp<float>(frameDt, 0.0f, 0.05f)); //-fix eroare la dragging ul ferestrei
+            recordInputLatency(snapshot);
         }
     }
+    // simularea se opreste odata cu fereastra
+    simThread.reset();
+    saveRecording();
+    if (inputLatency.samples > 0) {
+        std::cout << "Input-to-display latency: last " << inputLatency.last * 1000.0 << " ms, mean "
+                  << inputLatency.mean() * 1000.0 << " ms, max " << inputLatency.max * 1000.0 << " ms ("
+                  << inputLatency.samples << " samples)\n";
+    }
 }
 
 void Game::startLevel() {
-    map.loadLevel(currentLevel);
-
-    // recompute coins exactly as before
-    totalCoins = 0;
-    collectedCoins = 0;
-    for (int rr = 0; rr < map.getHeight(); ++rr) {
-        for (int cc = 0; cc < map.getWidth(); ++cc) {
-            TileType t = map.getTileTypeAtGrid(cc, rr);
-            if (t == TileType::Coin || t == TileType::FireCoin || t == TileType::WaterCoin || t == TileType::EarthCoin) totalCoins++;
+    // sim se modifica doar cu firul lui oprit
+    simThread.reset();
+    saveRecording();
+    sim.startLevel(currentLevel);
+
+    // arta personajelor e obligatorie pentru joc (simularea headless nu are nevoie de ea)
+    for (const auto& ch : sim.getCharacters()) {
+        if (ch && !characterRenderer.hasArt(ch->playerType())) {
+            throw ResourceLoadError(std::string("Failed to load mandatory asset: ") + TextureAtlas::assetPath(ch->playerType()));
         }
     }
+    renderMap = sim.getMap();
+    renderEpoch = sim.getLevelEpoch();
+    appliedTileEdits = 0;
+    levelEnded = false;
+    camera.snapTo(sim.charactersFocus(), renderMap.worldBounds());
 
-    initializeCharacters();
+    recording = Replay(Replay::levelId(currentLevel), sim.getTickRate());
+    startSimThread();
+    state = GameState::Playing;
+}
 
-    won = false;
-    gameOver = false;
-    charactersAtExit.assign(characters.size(), false);
+void Game::startSimThread() {
+    simThread = std::make_unique<SimulationThread>(sim, recordPath.empty() ? nullptr : &recording);
+}
 
-    state = GameState::Playing;
+void Game::saveRecording() {
+    if (recordPath.empty() || recording.empty()) return;
+    recording.save(recordPath);
+    std::cout << "Replay saved: " << recordPath << " (" << recording.ticks.size() << " ticks)\n";
 }
 
-void Game::processMenuInput() {
-    if (!window) return;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num1) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad1)) {
+void Game::handleMenuKey(sf::Keyboard::Key key) {
+    if (key == sf::Keyboard::Num1 || key == sf::Keyboard::Numpad1) {
         currentLevel = LevelType::Level1;
         startLevel();
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num2) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad2)) {
+    } else if (key == sf::Keyboard::Num2 || key == sf::Keyboard::Numpad2) {
         currentLevel = LevelType::Level2;
         startLevel();
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num3) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad3)) {
+    } else if (key == sf::Keyboard::Num3 || key == sf::Keyboard::Numpad3) {
         currentLevel = LevelType::Level3;
         startLevel();
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num4) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad4)) {
+    } else if (key == sf::Keyboard::Num4 || key == sf::Keyboard::Numpad4) {
         currentLevel = LevelType::Level4;
         startLevel();
     }
+}
 
+void Game::processMenuInput() {
+    if (!window) return;
     // Mouse-based menu interaction
     sf::Vector2i pixelPos = sf::Mouse::getPosition(*window);
     sf::Vector2f mousePos = window->mapPixelToCoords(pixelPos);
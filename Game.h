@@ -1,27 +1,48 @@
 #ifndef OOP_GAME_H
 #define OOP_GAME_H
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
 #include <SFML/Graphics.hpp>
-#include "Map.h"
-#include "Character.h"
+#include "Simulation.h"
+#include "MapRenderer.h"
+#include "CharacterRenderer.h"
 #include "Button.h"
 #include "HUD.h"
+#include "Camera.h"
+#include "SimulationThread.h"
+#include "Replay.h"
+#include "Profiler.h"
+#ifdef FBWG_PROFILER
+#include "ProfilerOverlay.h"
+#endif
 
+// Fereastra jocului: citeste tastatura si deseneaza prin camera. In timpul unui nivel Simulation
+// ruleaza pe firul ei (SimulationThread); aici se deseneaza doar snapshot-urile publicate de ea.
 class Game {
 private:
-    std::unique_ptr<sf::RenderWindow> window;
-    Map map;
+    // desenarea are firul ei si nu mai asteapta simularea: fara limita ar desena continuu, la 100% CPU.
+    // Peste rata tick-urilor, ca interpolarea sa se vada pe monitoarele rapide
+    static constexpr unsigned MaxFrameRate = 144;
 
-    std::vector<std::unique_ptr<Character>> characters;
+    std::unique_ptr<sf::RenderWindow> window;
+    // toata logica jocului, fara dependente de fereastra
+    Simulation sim;
+    // harta desenata: copie a hartii nivelului, tinuta la zi din WorldSnapshot::tileEdits
+    Map renderMap;
+    std::uint32_t renderEpoch = 0;
+    std::size_t appliedTileEdits = 0;
+    std::uint32_t renderTileRevision = 0;
+    // firul care ruleaza sim cat timp se joaca un nivel; oprit inaintea distrugerii lui sim
+    std::unique_ptr<SimulationThread> simThread;
+    // view-ul lumii; HUD-ul si ecranele de final se deseneaza cu view-ul implicit al ferestrei
+    Camera camera;
+    MapRenderer mapRenderer;
+    CharacterRenderer characterRenderer;
 
-    std::vector<std::unique_ptr<Character>> characterPrototypes;
-    // starea de de exit
-    std::vector<bool> charactersAtExit;
-    // pozitii de spawn
-    std::vector<sf::Vector2f> spawnPositions;
     // mapare controale per personaj
     struct Controls {
         sf::Keyboard::Key left;
@@ -29,17 +50,31 @@ private:
         sf::Keyboard::Key jump;
     };
     std::vector<Controls> characterControls;
-    
+    // ultimul snapshot desenat arata nivelul castigat/pierdut: R il reporneste
+    bool levelEnded = false;
+
+    // latenta input -> ecran: de la citirea tastei pana la display() pe frame-ul care arata
+    // primul tick ce a aplicat-o
+    struct InputLatency {
+        double last = 0.0;
+        double max = 0.0;
+        double total = 0.0;
+        std::size_t samples = 0;
+        double mean() const { return samples ? total / static_cast<double>(samples) : 0.0; }
+    };
+    InputLatency inputLatency;
+    double lastShownInputTime = 0.0;
+
+    // comenzile nivelului curent, scrise in recordPath la schimbarea nivelului si la inchidere
+    std::string recordPath;
+    Replay recording;
+
     // Game states and level tracking
     enum class GameState { Menu, Playing };
     GameState state = GameState::Menu;
+    // nivelul ales din meniu
     LevelType currentLevel = LevelType::Level1;
 
-    bool won = false;
-    bool gameOver = false;
-
-    int totalCoins = 0;
-    int collectedCoins = 0;
     // pentru afisarea mesajului de castig
     sf::Font winFont;
     sf::Text winText;
@@ -49,50 +84,83 @@ private:
 
     // HUD
     HUD gameHud;
+#ifdef FBWG_PROFILER
+    // F3: durata fazelor din frame si din tick, langa bara HUD-ului
+    ProfilerOverlay profilerOverlay;
+#endif
 
-    void processInput(float dt);
-    // Returns true if this character reached its exit during collision handling
-    bool handleCollisions(Character& ch);
-    void update(float dt);
-    void render();
+    // un eveniment de tastatura in timpul nivelului, citit la momentul time: tastele personajelor
+    // merg in coada firului simularii; Backspace tinut apasat da timpul inapoi;
+    // R dupa castig/pierdere reporneste nivelul
+    void handleKeyEvent(sf::Keyboard::Key key, bool pressed, double time);
+    // fereastra pierde focusul: KeyReleased nu mai vine, deci toate tastele se considera eliberate
+    void releaseAllKeys(double time);
+    // dupa display(): masoara latenta celui mai nou input aparut pe ecran
+    void recordInputLatency(const WorldSnapshot& snapshot);
+    // porneste firul simularii, cu inregistrare daca s-a cerut
+    void startSimThread();
+    // scrie replay-ul nivelului jucat (firul simularii trebuie sa fie oprit)
+    void saveRecording();
+    // aplica pe renderMap tile-urile schimbate de simulare (sau o reface dupa restart)
+    void syncRenderMap(const WorldSnapshot& snapshot);
+    // alpha: fractiunea din tick-ul urmator deja trecuta, pentru interpolare
+    void render(const WorldSnapshot& snapshot, float alpha, float frameDt);
     void resetLevel();
-    void handlePlatformCollisions(Character& ch);
-    void initializeCharacters();
     void startLevel();
+    void handleMenuKey(sf::Keyboard::Key key);
     void processMenuInput();
     void renderMenu();
 
 public:
-    explicit Game(int mapW = 14, int mapH = 9);
-    // copiere folosind clone() pentru personajele polimorfice
+    // fereastra are viewCols x viewRows tile-uri; nivelele mai mari se deruleaza cu camera.
+    // tickRate: pasi de simulare pe secunda, independent de refresh-ul monitorului
+    explicit Game(int viewCols = 14, int viewRows = 9, int tickRate = Simulation::DefaultTickRate);
+    // copiere: Simulation copiaza personajele prin clone(); doar cu firul simularii oprit,
+    // copia isi porneste propriul fir in run()
     Game(const Game& other);
 
     Game& operator=(Game other);
 
     void swap(Game& other) noexcept {
         using std::swap;
+        // firele tin referinte la sim-ul fiecarui obiect: se opresc, run() le reporneste
+        simThread.reset();
+        other.simThread.reset();
         swap(window, other.window);
-        swap(map, other.map);
-        swap(characters, other.characters);
-        swap(characterPrototypes, other.characterPrototypes);
-        swap(charactersAtExit, other.charactersAtExit);
-        swap(spawnPositions, other.spawnPositions);
+        swap(sim, other.sim);
+        swap(renderMap, other.renderMap);
+        swap(renderEpoch, other.renderEpoch);
+        swap(appliedTileEdits, other.appliedTileEdits);
+        swap(renderTileRevision, other.renderTileRevision);
+        swap(camera, other.camera);
+        swap(mapRenderer, other.mapRenderer);
+        swap(characterRenderer, other.characterRenderer);
         swap(characterControls, other.characterControls);
-        swap(won, other.won);
-        swap(gameOver, other.gameOver);
-        swap(totalCoins, other.totalCoins);
-        swap(collectedCoins, other.collectedCoins);
+        swap(levelEnded, other.levelEnded);
+        swap(inputLatency, other.inputLatency);
+        swap(lastShownInputTime, other.lastShownInputTime);
+        swap(recordPath, other.recordPath);
+        swap(recording, other.recording);
         swap(winFont, other.winFont);
         swap(winText, other.winText);
         swap(winFontLoaded, other.winFontLoaded);
         swap(loseText, other.loseText);
         swap(state, other.state);
+#ifdef FBWG_PROFILER
+        swap(profilerOverlay, other.profilerOverlay);
+#endif
         swap(currentLevel, other.currentLevel);
         swap(menuButtons, other.menuButtons);
         swap(isMouseHeld, other.isMouseHeld);
     }
     friend std::ostream& operator<<(std::ostream& os, const Game& g);
     void run();
+    // inregistreaza fiecare nivel jucat de acum in path (.fbwr); un nivel nou suprascrie fisierul
+    void recordTo(const std::string& path) { recordPath = path; }
+    // latenta input -> ecran, in secunde: ultima, media si maximul de la pornirea ferestrei
+    double lastInputLatency() const { return inputLatency.last; }
+    double meanInputLatency() const { return inputLatency.mean(); }
+    double maxInputLatency() const { return inputLatency.max; }
 private:
     // Menu UI
     std::vector<Button> menuButtons;
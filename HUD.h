@@ -17,6 +17,8 @@ public:
     void init(sf::Font& font, unsigned int windowWidth);
     void update(LevelType currentLevel, int collectedCoins, int totalCoins);
     void render(sf::RenderTarget& target) const;
+    // inaltimea barei de sus, ca alte panouri sa se aseze sub ea
+    float barHeight() const { return backgroundBar.getSize().y; }
 };
 
 #endif // OOP_HUD_H
@@ -0,0 +1,128 @@
+// oop_headless: ruleaza simularea fara fereastra si fara texturi (CI, servere fara display)
+// Utilizare: oop_headless [nivel 1-4 | fisier .txt/.fbwl] [pasi] [npc-uri] [inregistrare .fbwr]
+//            oop_headless --replay fisier.fbwr [repetari]
+//            oop_headless --help
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Simulation.h"
+#include "Replay.h"
+#include "GameExceptions.h"
+
+namespace {
+    void printUsage(std::ostream& os, const char* program) {
+        os << "usage: " << program << " [1-4 | level file] [steps > 0] [npcs >= 0] [record.fbwr, npcs = 0]\n"
+           << "       " << program << " --replay file.fbwr [repeats > 0]\n"
+           << "       " << program << " --help\n";
+    }
+
+    // ruleaza replay-ul de repeats ori, fara limita de viteza; fiecare rulare porneste nivelul de la zero,
+    // deci toate trebuie sa ajunga in aceeasi stare
+    int playReplay(const std::string& path, long repeats) {
+        const Replay replay = Replay::load(path);
+        Simulation sim(14, 9, static_cast<int>(replay.tickRate));
+        std::size_t restarts = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (long r = 0; r < repeats; ++r) {
+            replay.startLevel(sim);
+            restarts = replay.play(sim);
+        }
+        const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const double steps = static_cast<double>(replay.ticks.size()) * static_cast<double>(repeats);
+        const double gameSecs = steps / replay.tickRate;
+        std::cout << sim;
+        std::cout << "replay " << path << ": level " << replay.level << ", " << replay.ticks.size() << " ticks, "
+                  << restarts << " restarts, won=" << sim.isWon() << " gameOver=" << sim.isGameOver() << "\n";
+        std::cout << static_cast<long>(steps) << " steps in " << secs << " s (" << (secs > 0.0 ? steps / secs : 0.0)
+                  << " steps/s, " << (secs > 0.0 ? gameSecs / secs : 0.0) << "x real time)\n";
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        const std::string first = argc > 1 ? argv[1] : "";
+        if (first == "--help" || first == "-h") {
+            printUsage(std::cout, argv[0]);
+            return 0;
+        }
+        if (first == "--replay") {
+            const long repeats = argc > 3 ? std::strtol(argv[3], nullptr, 10) : 1;
+            if (argc < 3 || repeats <= 0) {
+                std::cerr << "usage: " << argv[0] << " --replay file.fbwr [repeats > 0]\n";
+                return 2;
+            }
+            return playReplay(argv[2], repeats);
+        }
+        // orice alta optiune e o greseala de tastare, nu un fisier de nivel sau de inregistrare
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg.rfind("--", 0) == 0 || arg == "-h") {
+                std::cerr << argv[0] << ": unknown option '" << arg << "'\n";
+                printUsage(std::cerr, argv[0]);
+                return 2;
+            }
+        }
+
+        const std::string level = argc > 1 ? argv[1] : "1";
+        const long steps = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 100000;
+        const long npcs = argc > 3 ? std::strtol(argv[3], nullptr, 10) : 0;
+        const std::string recordPath = argc > 4 ? argv[4] : "";
+        // replay-ul tine doar comenzile personajelor, nu si NPC-urile
+        if (steps <= 0 || npcs < 0 || (!recordPath.empty() && npcs != 0)) {
+            printUsage(std::cerr, argv[0]);
+            return 2;
+        }
+
+        Simulation sim;
+        Replay recording(level, sim.getTickRate());
+        recording.startLevel(sim);
+
+        // test de stres: NPC-uri cu elemente alternate, cate unul pe celula, rand cu rand de sus;
+        // actorii se ciocnesc intre ei, deci doar cand harta s-a umplut ajung unii peste altii
+        const int cols = sim.getMap().getWidth();
+        const int rows = sim.getMap().getHeight();
+        for (long n = 0; n < npcs; ++n) {
+            const float x = static_cast<float>((n % cols) * TileSize);
+            const float y = static_cast<float>((n / cols % rows) * TileSize);
+            sim.spawnNpc(static_cast<Element>(static_cast<std::size_t>(n) % ElementCount), {x, y},
+                         {TileSize * 0.5f, static_cast<float>(TileSize)});
+        }
+
+        std::vector<CharacterInput> inputs(sim.getActors().size());
+        long wins = 0, losses = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < steps; ++i) {
+            // script determinist: personajele merg alternativ stanga/dreapta si sar periodic
+            for (std::size_t c = 0; c < inputs.size(); ++c) {
+                const long phase = i + 37 * static_cast<long>(c);
+                inputs[c].right = (phase / 120) % 2 == 0;
+                inputs[c].left = !inputs[c].right;
+                inputs[c].jump = phase % 45 == 0;
+            }
+            if (!recordPath.empty()) recording.record(inputs);
+            sim.step(inputs);
+            if (sim.isWon()) { ++wins; sim.restart(); recording.recordRestart(); }
+            else if (sim.isGameOver()) { ++losses; sim.restart(); recording.recordRestart(); }
+        }
+        const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << sim;
+        std::cout << steps << " steps in " << secs << " s (" << (secs > 0.0 ? steps / secs : 0.0)
+                  << " steps/s), wins=" << wins << " losses=" << losses << "\n";
+        if (!recordPath.empty()) {
+            recording.save(recordPath);
+            std::cout << "replay saved: " << recordPath << "\n";
+        }
+        return 0;
+    } catch (const GameError& ge) {
+        std::cerr << "Game error: " << ge.what() << "\n";
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Unexpected error: " << e.what() << "\n";
+        return 2;
+    }
+}
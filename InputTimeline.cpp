@@ -0,0 +1,25 @@
+#include "InputTimeline.h"
+
+bool& InputTimeline::flag(CharacterInput& in, InputAction action) {
+    switch (action) {
+        case InputAction::Left: return in.left;
+        case InputAction::Right: return in.right;
+        case InputAction::Jump: break;
+    }
+    return in.jump;
+}
+
+const std::vector<CharacterInput>& InputTimeline::inputsUntil(double tickEnd) {
+    tickInputs = held;
+    while (!pending.empty() && pending.front().time <= tickEnd) {
+        const InputEvent& e = pending.front();
+        if (e.character < held.size()) {
+            flag(held[e.character], e.action) = e.pressed;
+            // apasat oricand in tick: conteaza pentru tot tick-ul, chiar daca s-a eliberat intre timp
+            if (e.pressed) flag(tickInputs[e.character], e.action) = true;
+        }
+        newestApplied = e.time;
+        pending.pop_front();
+    }
+    return tickInputs;
+}
@@ -0,0 +1,46 @@
+#ifndef OOP_INPUTTIMELINE_H
+#define OOP_INPUTTIMELINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "Simulation.h"
+
+enum class InputAction : std::uint8_t { Left, Right, Jump };
+
+// o tasta apasata sau eliberata, cu momentul in care a fost citita din fereastra
+// (secunde, acelasi ceas ca WorldSnapshot::tickTime)
+struct InputEvent {
+    double time = 0.0;
+    std::uint8_t character = 0;
+    InputAction action = InputAction::Left;
+    bool pressed = false;
+};
+
+// Transforma evenimentele de tastatura, in ordinea timpului, in comenzile fiecarui tick:
+// un tick care se termina la momentul T vede toate evenimentele de pana la T. Comanda unui tick e
+// tasta tinuta la inceputul lui sau apasata in timpul lui, deci o apasare mai scurta decat un tick
+// tot ajunge in simulare. Evenimentele sosite dupa ce tick-ul lor a rulat intra in primul tick urmator.
+class InputTimeline {
+private:
+    std::deque<InputEvent> pending;
+    // tastele tinute apasate dupa ultimul tick
+    std::vector<CharacterInput> held;
+    std::vector<CharacterInput> tickInputs;
+    double newestApplied = 0.0;
+
+    static bool& flag(CharacterInput& in, InputAction action);
+
+public:
+    explicit InputTimeline(std::size_t characters = 4) : held(characters) {}
+
+    // evenimentele vin in ordinea timpului (un singur producator)
+    void receive(const InputEvent& e) { pending.push_back(e); }
+    // comenzile tick-ului care se termina la tickEnd; valabile pana la urmatorul apel
+    const std::vector<CharacterInput>& inputsUntil(double tickEnd);
+    // momentul celui mai nou eveniment aplicat unui tick (0 = niciunul)
+    double newestAppliedTime() const { return newestApplied; }
+};
+
+#endif // OOP_INPUTTIMELINE_H
@@ -0,0 +1,124 @@
+#include "JobSystem.h"
+
+namespace {
+    // pentru workeri: sistemul din care fac parte si coada lor
+    thread_local const JobSystem* currentSystem = nullptr;
+    thread_local std::size_t currentIndex = 0;
+}
+
+JobSystem::JobSystem(std::size_t threadCount) {
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    queues.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    threads.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleep.notify_all();
+    for (auto& t : threads) t.join();
+}
+
+std::size_t JobSystem::currentQueue() const {
+    return currentSystem == this ? currentIndex : 0;
+}
+
+void JobSystem::push(const Job& job) {
+    Queue& q = *queues[currentQueue()];
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.jobs.push_back(job);
+    }
+    queued.fetch_add(1);
+    // sub mutex, ca un worker care tocmai a gasit cozile goale sa nu piarda notificarea
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    sleep.notify_one();
+}
+
+void JobSystem::spawn(Group& group, const Job& job) {
+    group.pending.fetch_add(1);
+    push(job);
+}
+
+void JobSystem::spawn(Group& group, std::function<void()> job) {
+    // jobul generic traieste pe heap pana ruleaza; parallelFor nu trece pe aici
+    auto* fn = new std::function<void()>(std::move(job));
+    spawn(group, Job{[](void* context, std::size_t, std::size_t) {
+        std::unique_ptr<std::function<void()>> owned(static_cast<std::function<void()>*>(context));
+        (*owned)();
+    }, fn, 0, 0, &group});
+}
+
+void JobSystem::execute(const Job& job) {
+    try {
+        job.run(job.context, job.begin, job.end);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(job.group->failureMutex);
+        if (!job.group->failure) job.group->failure = std::current_exception();
+    }
+    job.group->pending.fetch_sub(1);
+}
+
+bool JobSystem::runOne(std::size_t self) {
+    Job job{};
+    bool found = false;
+    {
+        Queue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    // furt: de la inceputul cozilor celorlalti, pornind de la vecinul urmator
+    for (std::size_t k = 1; !found && k < queues.size(); ++k) {
+        Queue& victim = *queues[(self + k) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+    if (!found) return false;
+    queued.fetch_sub(1);
+    execute(job);
+    return true;
+}
+
+void JobSystem::wait(Group& group) {
+    const std::size_t self = currentQueue();
+    while (group.pending.load() > 0) {
+        if (!runOne(self)) std::this_thread::yield();
+    }
+    if (group.failure) {
+        std::exception_ptr failure = std::move(group.failure);
+        group.failure = nullptr;
+        std::rethrow_exception(failure);
+    }
+}
+
+void JobSystem::workerLoop(std::size_t index) {
+    currentSystem = this;
+    currentIndex = index;
+    for (;;) {
+        if (runOne(index)) continue;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleep.wait(lock, [this] { return stopping || queued.load() > 0; });
+        if (stopping) return;
+    }
+}
+
+JobSystem& JobSystem::shared() {
+    static JobSystem system;
+    return system;
+}
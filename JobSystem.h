@@ -0,0 +1,127 @@
+#ifndef OOP_JOBSYSTEM_H
+#define OOP_JOBSYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Planificator de joburi cu work stealing, comun pentru fizica, incarcarea asset-urilor si restul
+// motorului. Fiecare worker are coada lui: isi ia joburile de la capatul unde le pune (LIFO, date
+// calde in cache), iar cand nu mai are, fura de la celalalt capat al cozii altuia (bucatile mari).
+// Firele din afara pool-ului (main, simularea) pun joburile intr-o coada comuna si, cat asteapta
+// un grup, executa si ele joburi.
+class JobSystem {
+public:
+    // joburile pornite impreuna; wait() se intoarce cand s-au terminat toate
+    class Group {
+        friend class JobSystem;
+        std::atomic<std::size_t> pending{0};
+        std::mutex failureMutex;
+        std::exception_ptr failure;
+    };
+
+private:
+    // un job fara alocari: functie + context + interval, pentru parallelFor
+    struct Job {
+        void (*run)(void* context, std::size_t begin, std::size_t end);
+        void* context;
+        std::size_t begin;
+        std::size_t end;
+        Group* group;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    // queues[0] e coada firelor din afara pool-ului; queues[i] e a worker-ului i
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+
+    std::atomic<std::size_t> queued{0};
+    std::mutex sleepMutex;
+    std::condition_variable sleep;
+    bool stopping = false;
+
+    void workerLoop(std::size_t index);
+    void push(const Job& job);
+    // coada firului curent: a worker-ului, sau cea comuna pentru firele din afara
+    std::size_t currentQueue() const;
+    // un job din coada proprie sau furat; false daca toate cozile sunt goale
+    bool runOne(std::size_t self);
+    static void execute(const Job& job);
+
+    template<typename Fn>
+    struct ForContext {
+        JobSystem* system;
+        Group* group;
+        Fn* fn;
+        std::size_t count;
+        std::size_t grain;
+    };
+    // imparte bucatile [c0, c1) in doua pana ramane una: jumatatea din dreapta devine job
+    // (de furat), cea din stanga continua pe firul curent
+    template<typename Fn>
+    static void splitRange(void* context, std::size_t c0, std::size_t c1) {
+        auto* ctx = static_cast<ForContext<Fn>*>(context);
+        while (c1 - c0 > 1) {
+            const std::size_t mid = c0 + (c1 - c0) / 2;
+            ctx->system->spawn(*ctx->group, {&splitRange<Fn>, context, mid, c1, ctx->group});
+            c1 = mid;
+        }
+        (*ctx->fn)(c0 * ctx->grain, std::min(c1 * ctx->grain, ctx->count));
+    }
+
+    void spawn(Group& group, const Job& job);
+
+public:
+    // threadCount: numarul total de fire care lucreaza, cu tot cu apelantul; 0 = cate nuclee are masina
+    explicit JobSystem(std::size_t threadCount = 0);
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    std::size_t workerCount() const { return threads.size() + 1; }
+
+    // porneste job in grupul dat; poate fi apelat si din interiorul altui job
+    void spawn(Group& group, std::function<void()> job);
+    // asteapta (executand joburi intre timp) terminarea grupului; arunca prima exceptie a unui job
+    void wait(Group& group);
+
+    // fn(begin, end) pe bucatile [k * grain, (k + 1) * grain) din [0, count), impartite recursiv
+    // intre workeri. Capetele bucatilor nu depind de planificare, deci begin / grain poate indexa
+    // un buffer per bucata. Sub un grain, sau fara alte fire, ruleaza direct pe firul curent.
+    template<typename Fn>
+    void parallelFor(std::size_t count, std::size_t grain, Fn&& fn) {
+        grain = std::max<std::size_t>(grain, 1);
+        if (count <= grain || threads.empty()) {
+            if (count > 0) fn(std::size_t{0}, count);
+            return;
+        }
+        using F = std::remove_reference_t<Fn>;
+        Group group;
+        ForContext<F> ctx{this, &group, &fn, count, grain};
+        try {
+            splitRange<F>(&ctx, 0, (count + grain - 1) / grain);
+        } catch (...) {
+            // joburile pornite deja folosesc ctx de pe stiva: intai se termina toate
+            std::lock_guard<std::mutex> lock(group.failureMutex);
+            if (!group.failure) group.failure = std::current_exception();
+        }
+        wait(group);
+    }
+
+    // sistemul comun al procesului, pornit la prima folosire
+    static JobSystem& shared();
+};
+
+#endif // OOP_JOBSYSTEM_H
@@ -0,0 +1,195 @@
+#include "Kinematics.h"
+#include <algorithm>
+
+#if defined(__AVX__)
+    #define FBWG_SIMD_AVX 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define FBWG_SIMD_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace {
+    // variantele scalare lucreaza pe [begin, count): tot lotul, sau coada ramasa dupa SIMD
+
+    void integrateRange(const Kinematics::IntegrateBatch& b, float gravity, float dt, std::size_t begin) {
+        const float gdt = gravity * dt;
+        for (std::size_t i = begin; i < b.count; ++i) {
+            b.velY[i] += gdt;
+            b.moveX[i] = b.walkX[i] + b.velX[i] * dt;
+            b.moveY[i] = b.velY[i] * dt;
+        }
+    }
+
+    void clampRange(const Kinematics::ClampBatch& b, const sf::FloatRect& world, std::size_t begin) {
+        const float left = world.left;
+        const float right = world.left + world.width;
+        const float bottom = world.top + world.height;
+        for (std::size_t i = begin; i < b.count; ++i) {
+            if (b.posY[i] + b.height[i] > bottom) {
+                b.posY[i] = bottom - b.height[i];
+                b.velY[i] = 0.f;
+                b.grounded[i] = 1;
+            }
+            b.posX[i] = std::min(std::max(b.posX[i], left), std::max(left, right - b.width[i]));
+        }
+    }
+
+    void platformRange(const Kinematics::PlatformBatch& b, float dt, std::size_t begin) {
+        for (std::size_t i = begin; i < b.count; ++i) {
+            const float dx = b.direction[i] * b.speed[i] * dt;
+            float x = b.posX[i] + dx;
+            bool turned = true;
+            if (x < b.xMin[i]) x = b.xMin[i];
+            else if (x > b.xMax[i]) x = b.xMax[i];
+            else turned = false;
+            b.posX[i] = x;
+            // pe frame-ul in care s-a lovit limita, platforma nu mai cara personajele
+            b.lastDx[i] = turned ? 0.f : dx;
+            if (turned) b.direction[i] = -b.direction[i];
+        }
+    }
+
+#if defined(FBWG_SIMD_AVX)
+    constexpr std::size_t Lanes = 8;
+    using Vec = __m256;
+    inline Vec load(const float* p) { return _mm256_loadu_ps(p); }
+    inline void store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+    inline Vec splat(float v) { return _mm256_set1_ps(v); }
+    inline Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    inline Vec sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+    inline Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    inline Vec vmin(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+    inline Vec vmax(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+    inline Vec less(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline Vec greater(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    inline Vec vand(Vec a, Vec b) { return _mm256_and_ps(a, b); }
+    inline Vec vandnot(Vec mask, Vec b) { return _mm256_andnot_ps(mask, b); }
+    inline Vec vor(Vec a, Vec b) { return _mm256_or_ps(a, b); }
+    inline Vec vxor(Vec a, Vec b) { return _mm256_xor_ps(a, b); }
+    inline Vec select(Vec mask, Vec ifTrue, Vec ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+    inline int maskBits(Vec mask) { return _mm256_movemask_ps(mask); }
+#elif defined(FBWG_SIMD_SSE2)
+    constexpr std::size_t Lanes = 4;
+    using Vec = __m128;
+    inline Vec load(const float* p) { return _mm_loadu_ps(p); }
+    inline void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    inline Vec splat(float v) { return _mm_set1_ps(v); }
+    inline Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    inline Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    inline Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    inline Vec vmin(Vec a, Vec b) { return _mm_min_ps(a, b); }
+    inline Vec vmax(Vec a, Vec b) { return _mm_max_ps(a, b); }
+    inline Vec less(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+    inline Vec greater(Vec a, Vec b) { return _mm_cmpgt_ps(a, b); }
+    inline Vec vand(Vec a, Vec b) { return _mm_and_ps(a, b); }
+    inline Vec vandnot(Vec mask, Vec b) { return _mm_andnot_ps(mask, b); }
+    inline Vec vor(Vec a, Vec b) { return _mm_or_ps(a, b); }
+    inline Vec vxor(Vec a, Vec b) { return _mm_xor_ps(a, b); }
+    // SSE2 nu are blendv: combinatie pe biti cu masca
+    inline Vec select(Vec mask, Vec ifTrue, Vec ifFalse) { return vor(vand(mask, ifTrue), vandnot(mask, ifFalse)); }
+    inline int maskBits(Vec mask) { return _mm_movemask_ps(mask); }
+#endif
+}
+
+namespace Kinematics {
+
+const char* simdName() {
+#if defined(FBWG_SIMD_AVX)
+    return "AVX";
+#elif defined(FBWG_SIMD_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+void integrateScalar(const IntegrateBatch& b, float gravity, float dt) {
+    integrateRange(b, gravity, dt, 0);
+}
+
+void clampToWorldScalar(const ClampBatch& b, const sf::FloatRect& world) {
+    clampRange(b, world, 0);
+}
+
+void advancePlatformsScalar(const PlatformBatch& b, float dt) {
+    platformRange(b, dt, 0);
+}
+
+#if defined(FBWG_SIMD_AVX) || defined(FBWG_SIMD_SSE2)
+
+void integrate(const IntegrateBatch& b, float gravity, float dt) {
+    const Vec gdt = splat(gravity * dt);
+    const Vec vdt = splat(dt);
+    std::size_t i = 0;
+    for (; i + Lanes <= b.count; i += Lanes) {
+        const Vec vy = add(load(b.velY + i), gdt);
+        store(b.velY + i, vy);
+        store(b.moveX + i, add(load(b.walkX + i), mul(load(b.velX + i), vdt)));
+        store(b.moveY + i, mul(vy, vdt));
+    }
+    integrateRange(b, gravity, dt, i);
+}
+
+void clampToWorld(const ClampBatch& b, const sf::FloatRect& world) {
+    const Vec left = splat(world.left);
+    const Vec right = splat(world.left + world.width);
+    const Vec bottom = splat(world.top + world.height);
+    std::size_t i = 0;
+    for (; i + Lanes <= b.count; i += Lanes) {
+        const Vec y = load(b.posY + i);
+        const Vec h = load(b.height + i);
+        const Vec below = greater(add(y, h), bottom);
+        store(b.posY + i, select(below, sub(bottom, h), y));
+        store(b.velY + i, vandnot(below, load(b.velY + i)));
+        // grounded e pe byte: doar benzile care au atins fundul se scriu
+        if (const int bits = maskBits(below)) {
+            for (std::size_t l = 0; l < Lanes; ++l) {
+                if (bits & (1 << l)) b.grounded[i + l] = 1;
+            }
+        }
+
+        const Vec maxX = vmax(left, sub(right, load(b.width + i)));
+        store(b.posX + i, vmin(vmax(load(b.posX + i), left), maxX));
+    }
+    clampRange(b, world, i);
+}
+
+void advancePlatforms(const PlatformBatch& b, float dt) {
+    const Vec vdt = splat(dt);
+    const Vec signBit = splat(-0.f);
+    std::size_t i = 0;
+    for (; i + Lanes <= b.count; i += Lanes) {
+        const Vec dir = load(b.direction + i);
+        const Vec dx = mul(mul(dir, load(b.speed + i)), vdt);
+        const Vec x = add(load(b.posX + i), dx);
+        const Vec lo = load(b.xMin + i);
+        const Vec hi = load(b.xMax + i);
+        const Vec underMin = less(x, lo);
+        // ca in varianta scalara: limita de jos are prioritate
+        const Vec overMax = vandnot(underMin, greater(x, hi));
+        const Vec turned = vor(underMin, overMax);
+        store(b.posX + i, select(underMin, lo, select(overMax, hi, x)));
+        store(b.lastDx + i, vandnot(turned, dx));
+        store(b.direction + i, vxor(dir, vand(turned, signBit)));
+    }
+    platformRange(b, dt, i);
+}
+
+#else
+
+void integrate(const IntegrateBatch& b, float gravity, float dt) {
+    integrateRange(b, gravity, dt, 0);
+}
+
+void clampToWorld(const ClampBatch& b, const sf::FloatRect& world) {
+    clampRange(b, world, 0);
+}
+
+void advancePlatforms(const PlatformBatch& b, float dt) {
+    platformRange(b, dt, 0);
+}
+
+#endif
+
+}
@@ -0,0 +1,62 @@
+#ifndef OOP_KINEMATICS_H
+#define OOP_KINEMATICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <SFML/Graphics/Rect.hpp>
+
+// Integrarea pe loturi de corpuri, direct pe vectorii SoA din ActorStore si PlatformStore.
+// Varianta vectoriala proceseaza 8 corpuri pe instructiune cu AVX (compilat cu -mavx / /arch:AVX)
+// sau 4 cu SSE2 (orice x86-64); restul lotului si celelalte platforme folosesc varianta scalara.
+// Ambele fac exact aceleasi operatii float in aceeasi ordine, deci rezultatele sunt identice.
+namespace Kinematics {
+
+    // campurile actorilor folosite de integrate()
+    struct IntegrateBatch {
+        float* velY;
+        const float* velX;
+        const float* walkX;
+        float* moveX; // iesire: deplasarea dorita in acest tick
+        float* moveY;
+        std::size_t count;
+    };
+
+    // campurile actorilor folosite de clampToWorld()
+    struct ClampBatch {
+        float* posX;
+        float* posY;
+        float* velY;
+        std::uint8_t* grounded;
+        const float* width;
+        const float* height;
+        std::size_t count;
+    };
+
+    // platformele mobile: miscare stanga-dreapta intre xMin si xMax
+    struct PlatformBatch {
+        float* posX;
+        float* direction; // +1 sau -1
+        float* lastDx;
+        const float* speed;
+        const float* xMin;
+        const float* xMax;
+        std::size_t count;
+    };
+
+    // setul de instructiuni al variantei vectoriale: "AVX", "SSE2" sau "scalar"
+    const char* simdName();
+
+    // velY += gravity * dt; move = (walkX + velX * dt, velY * dt)
+    void integrate(const IntegrateBatch& b, float gravity, float dt);
+    void integrateScalar(const IntegrateBatch& b, float gravity, float dt);
+
+    // actorii raman in lume; cei care ating fundul lumii devin grounded cu velY = 0
+    void clampToWorld(const ClampBatch& b, const sf::FloatRect& world);
+    void clampToWorldScalar(const ClampBatch& b, const sf::FloatRect& world);
+
+    // un pas pentru fiecare platforma; la capatul drumului se opreste pe limita si schimba directia
+    void advancePlatforms(const PlatformBatch& b, float dt);
+    void advancePlatformsScalar(const PlatformBatch& b, float dt);
+}
+
+#endif // OOP_KINEMATICS_H
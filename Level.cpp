@@ -0,0 +1,202 @@
+#include "Level.h"
+#include "GameExceptions.h"
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+    // tabela inversa caracter -> tip, construita o data
+    struct CharTable {
+        std::array<signed char, 256> types{};
+        CharTable() {
+            types.fill(-1);
+            for (int t = 0; t <= static_cast<int>(TileType::ExitAir); ++t) {
+                const char ch = LevelLoader::toChar(static_cast<TileType>(t));
+                types[static_cast<unsigned char>(ch)] = static_cast<signed char>(t);
+            }
+        }
+    };
+
+    std::string_view nextToken(std::string_view& line) {
+        std::size_t b = line.find_first_not_of(" \t\r");
+        if (b == std::string_view::npos) { line = {}; return {}; }
+        std::size_t e = line.find_first_of(" \t\r", b);
+        if (e == std::string_view::npos) e = line.size();
+        std::string_view tok = line.substr(b, e - b);
+        line.remove_prefix(e);
+        return tok;
+    }
+
+    int parseInt(std::string_view& line, const std::string& where) {
+        std::string_view tok = nextToken(line);
+        int value = 0;
+        auto res = std::from_chars(tok.data(), tok.data() + tok.size(), value);
+        if (tok.empty() || res.ec != std::errc() || res.ptr != tok.data() + tok.size()) {
+            throw InvalidMapError(where + ": expected an integer, got '" + std::string(tok) + "'");
+        }
+        return value;
+    }
+
+    // from_chars pe float nu e disponibil peste tot (libc++ mai vechi), folosim strtof
+    float parseFloat(std::string_view& line, const std::string& where) {
+        const std::string tok(nextToken(line));
+        char* end = nullptr;
+        const float value = std::strtof(tok.c_str(), &end);
+        if (tok.empty() || end != tok.c_str() + tok.size()) {
+            throw InvalidMapError(where + ": expected a number, got '" + tok + "'");
+        }
+        return value;
+    }
+
+    bool inside(int width, int height, GridPos p) {
+        return p.col >= 0 && p.col < width && p.row >= 0 && p.row < height;
+    }
+}
+
+void LevelLoader::checkLayout(int width, int height, const std::array<GridPos, 4>& spawns,
+                              const std::vector<PlatformSpec>& platforms, const std::string& sourceName) {
+    if (width <= 0 || height <= 0 || width > MaxDimension || height > MaxDimension) {
+        throw InvalidMapError(sourceName + ": level dimensions must be between 1 and " + std::to_string(MaxDimension));
+    }
+    for (const GridPos& spawn : spawns) {
+        if (!inside(width, height, spawn)) {
+            throw InvalidMapError(sourceName + ": every character needs a spawn inside the map");
+        }
+    }
+    for (const auto& p : platforms) {
+        if (!inside(width, height, p.start) || p.minCol > p.maxCol) {
+            throw InvalidMapError(sourceName + ": moving platform outside the map or with an empty range");
+        }
+    }
+}
+
+char LevelLoader::toChar(TileType t) {
+    switch (t) {
+        case TileType::Empty: return '.';
+        case TileType::Solid: return '#';
+        case TileType::Fire: return 'F';
+        case TileType::Water: return 'W';
+        case TileType::HalfFire: return 'f';
+        case TileType::HalfWater: return 'w';
+        case TileType::Coin: return 'o';
+        case TileType::FireCoin: return 'r';
+        case TileType::WaterCoin: return 'b';
+        case TileType::EarthCoin: return 'g';
+        case TileType::ExitFire: return '1';
+        case TileType::ExitWater: return '2';
+        case TileType::ExitEarth: return '3';
+        case TileType::ExitAir: return '4';
+    }
+    return '?';
+}
+
+bool LevelLoader::fromChar(char ch, TileType& out) {
+    static const CharTable table;
+    const signed char t = table.types[static_cast<unsigned char>(ch)];
+    if (t < 0) return false;
+    out = static_cast<TileType>(t);
+    return true;
+}
+
+LevelData LevelLoader::parse(std::string_view text, const std::string& sourceName) {
+    LevelData level;
+    std::array<bool, 4> hasSpawn{};
+    bool hasSize = false;
+    bool inTiles = false;
+    int lineNo = 0;
+
+    while (!text.empty()) {
+        std::size_t eol = text.find('\n');
+        std::string_view line = text.substr(0, eol);
+        text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+        ++lineNo;
+        const std::string where = sourceName + ":" + std::to_string(lineNo);
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        if (inTiles) {
+            if (static_cast<int>(level.tiles.size()) == level.width * level.height) {
+                if (line.find_first_not_of(" \t") == std::string_view::npos) continue;
+                throw InvalidMapError(where + ": more tile rows than the declared height");
+            }
+            if (static_cast<int>(line.size()) != level.width) {
+                throw InvalidMapError(where + ": tile row must have exactly " + std::to_string(level.width) + " characters");
+            }
+            for (char ch : line) {
+                TileType t;
+                if (!fromChar(ch, t)) {
+                    throw InvalidMapError(where + ": unknown tile character '" + std::string(1, ch) + "'");
+                }
+                level.tiles.push_back(t);
+                ++level.typeCounts[static_cast<std::size_t>(t)];
+            }
+            continue;
+        }
+
+        std::string_view rest = line;
+        std::string_view keyword = nextToken(rest);
+        if (keyword.empty() || keyword.front() == '#') continue;
+
+        if (keyword == "size") {
+            level.width = parseInt(rest, where);
+            level.height = parseInt(rest, where);
+            if (level.width <= 0 || level.height <= 0) {
+                throw InvalidMapError(where + ": level dimensions must be positive");
+            }
+            // singura alocare pentru tile-uri
+            level.tiles.reserve(static_cast<std::size_t>(level.width) * static_cast<std::size_t>(level.height));
+            hasSize = true;
+        } else if (keyword == "spawn") {
+            std::string_view who = nextToken(rest);
+            std::size_t idx;
+            if (who == "fire") idx = 0;
+            else if (who == "water") idx = 1;
+            else if (who == "earth") idx = 2;
+            else if (who == "air") idx = 3;
+            else throw InvalidMapError(where + ": unknown spawn '" + std::string(who) + "'");
+            level.spawns[idx].col = parseInt(rest, where);
+            level.spawns[idx].row = parseInt(rest, where);
+            hasSpawn[idx] = true;
+        } else if (keyword == "platform") {
+            PlatformSpec p;
+            p.start.col = parseInt(rest, where);
+            p.start.row = parseInt(rest, where);
+            p.minCol = parseInt(rest, where);
+            p.maxCol = parseInt(rest, where);
+            p.speed = parseFloat(rest, where);
+            p.direction = parseInt(rest, where);
+            level.platforms.push_back(p);
+        } else if (keyword == "tiles") {
+            if (!hasSize) throw InvalidMapError(where + ": 'size' must come before 'tiles'");
+            inTiles = true;
+        } else {
+            throw InvalidMapError(where + ": unknown directive '" + std::string(keyword) + "'");
+        }
+    }
+
+    if (!inTiles || static_cast<int>(level.tiles.size()) != level.width * level.height) {
+        throw InvalidMapError(sourceName + ": expected " + std::to_string(level.height) + " tile rows");
+    }
+    for (std::size_t i = 0; i < level.spawns.size(); ++i) {
+        if (!hasSpawn[i]) {
+            throw InvalidMapError(sourceName + ": every character needs a spawn inside the map");
+        }
+    }
+    checkLayout(level.width, level.height, level.spawns, level.platforms, sourceName);
+    return level;
+}
+
+LevelData LevelLoader::loadFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw ResourceLoadError("Failed to open level file: " + path);
+    }
+    // citim tot fisierul dintr-o data, apoi parsam pe string_view
+    const std::streamsize size = in.tellg();
+    std::string text(static_cast<std::size_t>(size), '\0');
+    in.seekg(0);
+    if (!in.read(text.data(), size)) {
+        throw ResourceLoadError("Failed to read level file: " + path);
+    }
+    return parse(text, path);
+}
@@ -0,0 +1,56 @@
+#ifndef OOP_LEVEL_H
+#define OOP_LEVEL_H
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "TileType.h"
+
+// pozitie in grila (coloana, rand)
+struct GridPos {
+    int col = 0;
+    int row = 0;
+};
+
+// platforma mobila descrisa in tile-uri; se misca orizontal intre minCol si maxCol
+struct PlatformSpec {
+    GridPos start;
+    int minCol = 0;
+    int maxCol = 0;
+    float speed = 80.f;
+    int direction = 1;
+};
+
+// Continutul unui fisier de nivel, gata de mutat in Map
+struct LevelData {
+    int width = 0;
+    int height = 0;
+    std::vector<TileType> tiles; // row-major, width*height
+    std::vector<PlatformSpec> platforms;
+    // spawn-uri in ordinea PlayerType: Fireboy, Watergirl, Earthboy, Airgirl
+    std::array<GridPos, 4> spawns{};
+    // cate tile-uri din fiecare tip, numarate la parsare; levelc le scrie in .fbwl
+    std::array<std::size_t, TileTypeCount> typeCounts{};
+};
+
+// Format text (vezi assets/levels/*.txt): directive "size", "spawn", "platform",
+// apoi sectiunea "tiles" cu cate un caracter per tile. Parsarea e o singura trecere;
+// vectorul de tile-uri se aloca o data, la directiva "size".
+class LevelLoader {
+public:
+    // latimea/inaltimea maxima, in tile-uri (indicii de chunk si de celula raman in int/uint32)
+    static constexpr int MaxDimension = 1 << 20;
+
+    static LevelData parse(std::string_view text, const std::string& sourceName = "<memory>");
+    static LevelData loadFile(const std::string& path);
+    // regulile comune formatelor text si binar: dimensiuni in (0, MaxDimension], toate spawn-urile si
+    // platformele in interiorul hartii, platforme cu interval nevid; arunca InvalidMapError
+    static void checkLayout(int width, int height, const std::array<GridPos, 4>& spawns,
+                            const std::vector<PlatformSpec>& platforms, const std::string& sourceName);
+
+    static char toChar(TileType t);
+    static bool fromChar(char ch, TileType& out);
+};
+
+#endif // OOP_LEVEL_H
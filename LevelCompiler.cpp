@@ -0,0 +1,23 @@
+// levelc: compileaza nivelele text (assets/levels/*.txt) in formatul binar .fbwl
+// Utilizare: levelc <input.txt> <output.fbwl>
+#include <iostream>
+#include "BinaryLevel.h"
+#include "GameExceptions.h"
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <input.txt> <output" << BinaryLevel::Extension << ">\n";
+        return 2;
+    }
+    try {
+        const LevelData level = LevelLoader::loadFile(argv[1]);
+        BinaryLevel::write(level, argv[2]);
+        std::cout << "levelc: " << argv[1] << " -> " << argv[2]
+                  << " (" << level.width << "x" << level.height << ", "
+                  << level.platforms.size() << " platforms)\n";
+        return 0;
+    } catch (const GameError& ge) {
+        std::cerr << "levelc: " << ge.what() << "\n";
+        return 1;
+    }
+}
@@ -1,13 +1,22 @@
 #ifndef OOP_MAP_H
 #define OOP_MAP_H
 
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
 #include <vector>
 #include <ostream>
-#include <SFML/Graphics.hpp>
-#include "Tile.h"
-#include "MovingPlatform.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "TileType.h"
+#include "Level.h"
+#include "TileStorage.h"
+#include "TileOccupancy.h"
+#include "CollisionRules.h"
+#include "PlatformStore.h"
 
-// Levels available in the game
+// Levels available in the game; each one is a file in assets/levels
 enum class LevelType {
     Level1,
     Level2,
@@ -17,16 +26,24 @@ enum class LevelType {
 
 class Map {
 private:
-    std::vector<std::vector<Tile>> grid;
+    // tipurile tile-urilor, pe chunk-uri copy-on-write peste sursa nivelului (1 byte per tile);
+    // pentru nivelele compilate (.fbwl) sursa este chiar fisierul mapat
+    TileStorage tiles;
+    // bitset-uri per TileType pe chunk-uri construite la cerere, pentru interogari pe dreptunghiuri
+    // (coliziuni, numarare monede)
+    TileOccupancy occupancy;
     int width{}, height{};
-    std::vector<MovingPlatform> movingPlatforms;
+    PlatformStore platforms;
+    // platformele exact cum erau dupa incarcare; tile-urile initiale sunt chiar sursa din TileStorage
+    PlatformStore pristinePlatforms;
+    // spawn-uri in ordinea PlayerType (Fireboy, Watergirl, Earthboy, Airgirl)
+    std::array<GridPos, 4> spawns{};
 
     void allocateGrid(int w, int h, TileType defaultType = TileType::Empty);
-    void generateLevel1();
-    void generateLevel2();
-    void generateLevel3();
-    void generateLevel4();
-    void clear();
+    // dimensiuni, spawn-uri, platforme si numaratorile de tile-uri, dupa ce tiles a fost setat
+    void applyLayout(int w, int h, const std::array<GridPos, 4>& levelSpawns,
+                     const std::vector<PlatformSpec>& platformSpecs, const TileOccupancy::Counts& typeCounts);
+    sf::Vector2f spawnWorldPos(std::size_t index) const;
 
 public:
     explicit Map(int w = 12, int h = 8, TileType defaultType = TileType::Empty);
@@ -37,19 +54,54 @@ public:
     int getWidth() const { return width; }
     int getHeight() const { return height; }
 
-    // Legacy generator kept for backward-compat; Level1 is the original layout
-
-    // Load a specific level layout
+    // Load a level by ID or from an explicit level file (.txt parsed, .fbwl memory-mapped).
+    // By ID, the compiled assets/levels/levelN.fbwl is preferred when levelc produced it.
     void loadLevel(LevelType level);
+    void loadLevel(const std::string& path);
+    static std::string levelFilePath(LevelType level);
+    static std::string compiledLevelPath(LevelType level);
+    // readuce nivelul curent la starea de dupa incarcare (restart), fara a reciti fisierul:
+    // se anuleaza doar chunk-urile modificate, deci costul nu depinde de marimea hartii
+    void restorePristine();
+    // la inceputul fiecarui tick: pozitiile curente devin capatul anterior al interpolarii
+    void beginTick();
     void update(float dt);
 
-    TileType getTileTypeAtGrid(int col, int row) const;
+    // apelat in bucla de coliziuni: inline, un bit din masca si o citire din sursa
+    TileType getTileTypeAtGrid(int col, int row) const {
+        if (col < 0 || col >= width || row < 0 || row >= height) return TileType::Solid;
+        return tiles.get(col, row);
+    }
     [[maybe_unused]] TileType getTileTypeAtWorld(float x, float y) const;
 
     // setter util pentru a modifica un tile in timpul jocului (ex: colectare moneda)
     void setTileTypeAtGrid(int col, int row, TileType t);
 
-    void draw(sf::RenderTarget& target) const;
+    // celulele cu unul din tipurile din types, in dreptunghiul de grila [col0,col1]x[row0,row1]
+    // (deja limitat la harta), row-major; fn(col,row) intoarce false pentru a opri
+    template <typename Fn>
+    void forEachTileIn(TileMask types, int col0, int row0, int col1, int row1, Fn&& fn) const {
+        occupancy.forEach(tiles, types, col0, row0, col1, row1, std::forward<Fn>(fn));
+    }
+    std::size_t countTiles(TileMask types) const { return occupancy.count(types); }
+
+    // monedele ramase, tinute la zi la incarcare si in setTileTypeAtGrid: O(1), fara scanarea hartii
+    std::size_t remainingCoins() const { return occupancy.count(CoinTiles); }
+    std::size_t remainingCoins(TileType coinType) const { return occupancy.count(tileBit(coinType) & CoinTiles); }
+    // monedele pe care le poate colecta un personaj cu elementul dat (inclusiv cele generice)
+    std::size_t remainingCoinsFor(Element e) const {
+        return occupancy.count(CollisionRules::tilesWith(e, CollisionRules::CollectCoin));
+    }
+    // pozitiile monedelor ramase, direct din straturile de biti ale monedelor
+    template <typename Fn>
+    void forEachCoin(Fn&& fn) const {
+        if (width <= 0 || height <= 0) return;
+        occupancy.forEach(tiles, CoinTiles, 0, 0, width - 1, height - 1, [&](int col, int row) {
+            fn(GridPos{col, row});
+            return true;
+        });
+    }
+
     friend std::ostream& operator<<(std::ostream& os, const Map& m);
 
     sf::FloatRect worldBounds() const;
@@ -59,7 +111,12 @@ public:
     sf::Vector2f respawnWorldPosForEarth() const;
     sf::Vector2f respawnWorldPosForAir() const;
 
-    const std::vector<MovingPlatform>& getMovingPlatforms() const { return movingPlatforms; }
+    const PlatformStore& getPlatforms() const { return platforms; }
+    // starea platformelor mobile, pentru rewind (Simulation::saveState/loadState)
+    void savePlatformState(StateBytes::Buffer& out) const { platforms.saveState(out); }
+    const std::uint8_t* loadPlatformState(const std::uint8_t* in) { return platforms.loadState(in); }
+    // pentru MapRenderer: tile-urile pe chunk-uri, cu revizii per chunk
+    const TileStorage& getTiles() const { return tiles; }
 };
 
 #endif // OOP_MAP_H
@@ -0,0 +1,26 @@
+#include "MapRenderer.h"
+#include "TextureAtlas.h"
+
+MapRenderer::MapRenderer() {
+    platformShape.setSize({static_cast<float>(Tile::getSize()), static_cast<float>(Tile::getSize())});
+    // aceeasi textura legata ca restul scenei (zona alba din atlas)
+    platformShape.setTexture(&TextureAtlas::getInstance().getTexture());
+    platformShape.setTextureRect(TextureAtlas::getInstance().solidColorRegion());
+    platformShape.setFillColor(sf::Color(150, 90, 30));
+    platformShape.setOutlineColor(sf::Color::Black);
+    platformShape.setOutlineThickness(1.f);
+}
+
+void MapRenderer::draw(sf::RenderTarget& target, const Map& map, const WorldSnapshot& snapshot, float alpha) {
+    // zona vizibila in coordonate lume; doar chunk-urile care o intersecteaza au geometrie
+    const sf::View& view = target.getView();
+    const sf::FloatRect visible(view.getCenter() - view.getSize() / 2.f, view.getSize());
+    tileLayer.draw(target, map.getTiles(), visible);
+
+    for (std::size_t p = 0; p < snapshot.platforms.size(); ++p) {
+        const sf::FloatRect b = snapshot.platformBounds(p, alpha);
+        if (!b.intersects(visible)) continue;
+        platformShape.setPosition(b.left, b.top);
+        target.draw(platformShape);
+    }
+}
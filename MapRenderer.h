@@ -0,0 +1,24 @@
+#ifndef OOP_MAPRENDERER_H
+#define OOP_MAPRENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include "Map.h"
+#include "WorldSnapshot.h"
+#include "TileLayer.h"
+
+// Desenarea hartii: stratul de tile-uri pe chunk-uri si platformele mobile.
+// Map ramane doar date si logica; aici e tot ce tine de SFML graphics.
+class MapRenderer {
+private:
+    TileLayer tileLayer;
+    sf::RectangleShape platformShape;
+
+public:
+    MapRenderer();
+
+    // deseneaza doar chunk-urile si platformele din view-ul curent al target-ului;
+    // platformele vin separat (din WorldSnapshot) si sunt interpolate intre ultimele doua tick-uri
+    void draw(sf::RenderTarget& target, const Map& map, const WorldSnapshot& snapshot, float alpha = 1.f);
+};
+
+#endif // OOP_MAPRENDERER_H
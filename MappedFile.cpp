@@ -0,0 +1,96 @@
+#include "MappedFile.h"
+#include "GameExceptions.h"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile MappedFile::openPrivate(const std::string& path) {
+    MappedFile mf;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw ResourceLoadError("Failed to open file for mapping: " + path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        throw ResourceLoadError("Cannot map empty or unreadable file: " + path);
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        throw ResourceLoadError("Failed to create file mapping: " + path);
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    // view-ul pastreaza maparea in viata, handle-ul nu mai e necesar
+    CloseHandle(mapping);
+    if (!view) {
+        throw ResourceLoadError("Failed to map file: " + path);
+    }
+    mf.address = view;
+    mf.length = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw ResourceLoadError("Failed to open file for mapping: " + path);
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        throw ResourceLoadError("Cannot map empty or unreadable file: " + path);
+    }
+    void* addr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // maparea ramane valida si dupa inchiderea descriptorului
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        throw ResourceLoadError("Failed to map file: " + path);
+    }
+    mf.address = addr;
+    mf.length = static_cast<std::size_t>(st.st_size);
+#endif
+    return mf;
+}
+
+void MappedFile::release() noexcept {
+    if (!address) return;
+#ifdef _WIN32
+    UnmapViewOfFile(address);
+#else
+    ::munmap(address, length);
+#endif
+    address = nullptr;
+    length = 0;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : address(std::exchange(other.address, nullptr)),
+      length(std::exchange(other.length, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        address = std::exchange(other.address, nullptr);
+        length = std::exchange(other.length, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
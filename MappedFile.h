@@ -0,0 +1,33 @@
+#ifndef OOP_MAPPEDFILE_H
+#define OOP_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// Fisier mapat in memorie, privat (copy-on-write): paginile se incarca la prima citire,
+// iar scrierile creeaza copii private si nu ajung niciodata in fisierul de pe disc.
+class MappedFile {
+private:
+    void* address = nullptr;
+    std::size_t length = 0;
+
+    void release() noexcept;
+
+public:
+    MappedFile() = default;
+    // arunca ResourceLoadError daca fisierul nu poate fi deschis sau mapat
+    static MappedFile openPrivate(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    std::byte* data() { return static_cast<std::byte*>(address); }
+    const std::byte* data() const { return static_cast<const std::byte*>(address); }
+    std::size_t size() const { return length; }
+    bool isOpen() const { return address != nullptr; }
+};
+
+#endif // OOP_MAPPEDFILE_H
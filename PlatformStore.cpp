@@ -0,0 +1,112 @@
+#include "PlatformStore.h"
+#include "Kinematics.h"
+#include <algorithm>
+
+void PlatformStore::add(const sf::Vector2f& startPos, float minX, float maxX, float spd, int dir) {
+    posX.push_back(startPos.x);
+    posY.push_back(startPos.y);
+    prevX.push_back(startPos.x);
+    direction.push_back(static_cast<float>(dir));
+    speed.push_back(spd);
+    xMin.push_back(minX);
+    xMax.push_back(maxX);
+    lastDx.push_back(0.f);
+    cellCol0.push_back(0); cellCol1.push_back(0);
+    cellRow0.push_back(0); cellRow1.push_back(0);
+
+    // hash-ul tine cel mult o platforma per bucket in medie
+    if (buckets.size() < 2 * posX.size()) {
+        rehash(std::max<std::size_t>(64, 4 * posX.size()));
+    } else {
+        insertCells(posX.size() - 1);
+    }
+}
+
+void PlatformStore::insertCells(std::size_t i) {
+    const sf::FloatRect b = bounds(i);
+    cellCol0[i] = cellOf(b.left);
+    cellCol1[i] = cellOf(b.left + b.width);
+    cellRow0[i] = cellOf(b.top);
+    cellRow1[i] = cellOf(b.top + b.height);
+    const auto id = static_cast<std::uint32_t>(i);
+    for (int row = cellRow0[i]; row <= cellRow1[i]; ++row) {
+        for (int col = cellCol0[i]; col <= cellCol1[i]; ++col) {
+            // doua celule ale aceleiasi platforme pot avea acelasi bucket: Id-ul intra o singura data,
+            // altfel forEachNear l-ar raporta de doua ori
+            auto& bucket = buckets[bucketOf(col, row)];
+            if (std::find(bucket.begin(), bucket.end(), id) == bucket.end()) bucket.push_back(id);
+        }
+    }
+}
+
+void PlatformStore::eraseCells(std::size_t i) {
+    const auto id = static_cast<std::uint32_t>(i);
+    for (int row = cellRow0[i]; row <= cellRow1[i]; ++row) {
+        for (int col = cellCol0[i]; col <= cellCol1[i]; ++col) {
+            // ordinea din bucket nu conteaza: swap cu ultimul si pop
+            auto& bucket = buckets[bucketOf(col, row)];
+            const auto it = std::find(bucket.begin(), bucket.end(), id);
+            if (it != bucket.end()) {
+                *it = bucket.back();
+                bucket.pop_back();
+            }
+        }
+    }
+}
+
+void PlatformStore::rehash(std::size_t bucketCount) {
+    std::size_t n = 1;
+    while (n < bucketCount) n <<= 1;
+    buckets.assign(n, {});
+    for (std::size_t i = 0; i < posX.size(); ++i) insertCells(i);
+}
+
+void PlatformStore::reindex() {
+    for (std::size_t i = 0; i < posX.size(); ++i) {
+        const sf::FloatRect b = bounds(i);
+        if (cellOf(b.left) == cellCol0[i] && cellOf(b.left + b.width) == cellCol1[i] &&
+            cellOf(b.top) == cellRow0[i] && cellOf(b.top + b.height) == cellRow1[i]) {
+            continue;
+        }
+        eraseCells(i);
+        insertCells(i);
+    }
+}
+
+void PlatformStore::clear() {
+    posX.clear(); posY.clear();
+    prevX.clear();
+    direction.clear();
+    speed.clear();
+    xMin.clear(); xMax.clear();
+    lastDx.clear();
+    cellCol0.clear(); cellCol1.clear();
+    cellRow0.clear(); cellRow1.clear();
+    buckets.clear();
+}
+
+void PlatformStore::beginTick() {
+    std::copy(posX.begin(), posX.end(), prevX.begin());
+}
+
+void PlatformStore::update(float dt) {
+    Kinematics::advancePlatforms({posX.data(), direction.data(), lastDx.data(),
+                                  speed.data(), xMin.data(), xMax.data(), size()}, dt);
+    reindex();
+}
+
+void PlatformStore::saveState(StateBytes::Buffer& out) const {
+    StateBytes::append(out, posX);
+    StateBytes::append(out, prevX);
+    StateBytes::append(out, direction);
+    StateBytes::append(out, lastDx);
+}
+
+const std::uint8_t* PlatformStore::loadState(const std::uint8_t* in) {
+    in = StateBytes::read(in, posX);
+    in = StateBytes::read(in, prevX);
+    in = StateBytes::read(in, direction);
+    in = StateBytes::read(in, lastDx);
+    reindex();
+    return in;
+}
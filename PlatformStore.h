@@ -0,0 +1,103 @@
+#ifndef OOP_PLATFORMSTORE_H
+#define OOP_PLATFORMSTORE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "StateBytes.h"
+#include "TileType.h"
+
+// Platformele mobile ale hartii ca structure-of-arrays; update() le muta pe toate odata
+// prin Kinematics (SIMD). Doar logica: desenarea e in MapRenderer.
+// Un spatial hash pe celulele de tile gaseste platformele dintr-o zona fara a le parcurge pe toate;
+// e actualizat incremental, doar pentru platformele care au trecut in alte celule.
+class PlatformStore {
+private:
+    std::vector<float> posX, posY;
+    // pozitia de la inceputul tick-ului, pentru interpolarea desenarii
+    std::vector<float> prevX;
+    std::vector<float> direction; // +1 / -1 (inmultit cu speed)
+    std::vector<float> speed;
+    std::vector<float> xMin, xMax;
+    std::vector<float> lastDx;
+
+    // celulele atinse de fiecare platforma la ultima indexare: [col0, col1] x [row0, row1]
+    std::vector<int> cellCol0, cellCol1, cellRow0, cellRow1;
+    // bucket-urile hash-ului (putere a lui 2): Id-urile platformelor care ating o celula cu acel hash,
+    // fiecare cel mult o data
+    std::vector<std::vector<std::uint32_t>> buckets;
+
+    static int cellOf(float coord) { return static_cast<int>(std::floor(coord / static_cast<float>(TileSize))); }
+    std::size_t bucketOf(int col, int row) const {
+        const std::uint32_t h = static_cast<std::uint32_t>(col) * 73856093u ^ static_cast<std::uint32_t>(row) * 19349663u;
+        return h & (buckets.size() - 1);
+    }
+    bool covers(std::size_t i, int col, int row) const {
+        return col >= cellCol0[i] && col <= cellCol1[i] && row >= cellRow0[i] && row <= cellRow1[i];
+    }
+    void insertCells(std::size_t i);
+    void eraseCells(std::size_t i);
+    // dupa miscare: muta in hash doar platformele care au schimbat celulele
+    void reindex();
+    void rehash(std::size_t bucketCount);
+
+public:
+    void add(const sf::Vector2f& startPos, float minX, float maxX, float spd = 80.f, int dir = 1);
+    void clear();
+    std::size_t size() const { return posX.size(); }
+
+    void beginTick();
+    void update(float dt);
+
+    sf::FloatRect bounds(std::size_t i) const {
+        return sf::FloatRect(posX[i], posY[i], static_cast<float>(TileSize), static_cast<float>(TileSize));
+    }
+    // alpha 0 = inceputul tick-ului, 1 = pozitia curenta
+    sf::FloatRect interpolatedBounds(std::size_t i, float alpha) const {
+        const float x = prevX[i] + (posX[i] - prevX[i]) * alpha;
+        return sf::FloatRect(x, posY[i], static_cast<float>(TileSize), static_cast<float>(TileSize));
+    }
+    // cat s-a miscat platforma in ultimul tick (0 in tick-ul in care a intors)
+    float lastDeltaX(std::size_t i) const { return lastDx[i]; }
+
+    // pozitiile si sensul de mers, pentru rewind; platformele se misca doar pe X
+    void saveState(StateBytes::Buffer& out) const;
+    // citeste ce a scris saveState pentru acelasi numar de platforme si reface hash-ul
+    const std::uint8_t* loadState(const std::uint8_t* in);
+
+    // fn(id) pentru fiecare platforma care poate atinge area (inclusiv cele lipite de ea), o singura
+    // data; lista e conservatoare, apelantul face testul exact. Fara stare, sigur din mai multe thread-uri.
+    template <typename Fn>
+    void forEachNear(const sf::FloatRect& area, Fn&& fn) const {
+        if (posX.empty()) return;
+        const int col0 = cellOf(area.left);
+        const int col1 = cellOf(area.left + area.width);
+        const int row0 = cellOf(area.top);
+        const int row1 = cellOf(area.top + area.height);
+        // mai putine platforme decat celule in zona (nivelele obisnuite, sau tot ecranul): mai ieftin liniar
+        const std::size_t cells = static_cast<std::size_t>(col1 - col0 + 1) * static_cast<std::size_t>(row1 - row0 + 1);
+        if (posX.size() <= cells) {
+            for (std::size_t i = 0; i < posX.size(); ++i) {
+                if (cellCol1[i] >= col0 && cellCol0[i] <= col1 && cellRow1[i] >= row0 && cellRow0[i] <= row1) fn(i);
+            }
+            return;
+        }
+        for (int row = row0; row <= row1; ++row) {
+            for (int col = col0; col <= col1; ++col) {
+                for (const std::uint32_t id : buckets[bucketOf(col, row)]) {
+                    // bucket-ul poate contine si alte celule (coliziuni de hash); o platforma pe mai
+                    // multe celule e raportata doar din prima ei celula aflata in zona
+                    if (!covers(id, col, row)) continue;
+                    if (col != std::max(cellCol0[id], col0) || row != std::max(cellRow0[id], row0)) continue;
+                    fn(static_cast<std::size_t>(id));
+                }
+            }
+        }
+    }
+};
+
+#endif // OOP_PLATFORMSTORE_H
@@ -0,0 +1,60 @@
+#include "Profiler.h"
+#include <algorithm>
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+const char* Profiler::name(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Input: return "input";
+        case ProfilePhase::Platforms: return "platforms";
+        case ProfilePhase::Actors: return "actors";
+        case ProfilePhase::PlatformCollisions: return "platform coll.";
+        case ProfilePhase::Collisions: return "collisions";
+        case ProfilePhase::Interactions: return "interactions";
+        case ProfilePhase::MapDraw: return "map draw";
+        case ProfilePhase::Display: return "display";
+        case ProfilePhase::Count: break;
+    }
+    return "?";
+}
+
+void Profiler::commit(ProfilePhase first, ProfilePhase last) {
+    for (std::size_t p = index(first); p <= index(last); ++p) {
+        Track& track = tracks[p];
+        const std::uint64_t n = track.written.load(std::memory_order_relaxed);
+        track.samples[n % History].store(static_cast<float>(track.pending), std::memory_order_relaxed);
+        track.written.store(n + 1, std::memory_order_release);
+        track.pending = 0.0;
+    }
+}
+
+double Profiler::sample(ProfilePhase phase, std::size_t age) const {
+    const Track& track = tracks[index(phase)];
+    const std::uint64_t n = track.written.load(std::memory_order_acquire);
+    if (age >= History || age >= n) return 0.0;
+    return track.samples[(n - 1 - age) % History].load(std::memory_order_relaxed);
+}
+
+Profiler::Stats Profiler::stats(ProfilePhase phase) const {
+    const Track& track = tracks[index(phase)];
+    const std::size_t count = static_cast<std::size_t>(
+        std::min<std::uint64_t>(track.written.load(std::memory_order_acquire), History));
+    Stats s;
+    if (count == 0) return s;
+
+    std::array<float, History> sorted{};
+    for (std::size_t age = 0; age < count; ++age) sorted[age] = static_cast<float>(sample(phase, age));
+    s.last = sorted[0];
+    const auto end = sorted.begin() + static_cast<std::ptrdiff_t>(count);
+    const auto at = [&](double q) {
+        const auto nth = sorted.begin() + static_cast<std::ptrdiff_t>(q * static_cast<double>(count - 1));
+        std::nth_element(sorted.begin(), nth, end);
+        return static_cast<double>(*nth);
+    };
+    s.p50 = at(0.50);
+    s.p99 = at(0.99);
+    return s;
+}
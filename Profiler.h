@@ -0,0 +1,88 @@
+#ifndef OOP_PROFILER_H
+#define OOP_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Fazele masurate, grupate pe firul care le ruleaza: intai cele ale firului ferestrei care preced
+// simularea, apoi tick-ul din Simulation::step, apoi desenarea.
+enum class ProfilePhase : std::uint8_t {
+    Input,              // citirea evenimentelor din fereastra
+    Platforms,          // platformele mobile (Map::update)
+    Actors,             // comenzi + gravitatie pentru toti actorii
+    PlatformCollisions, // scoaterea din platforme si caratul pe ele
+    Collisions,         // broadphase + swept AABB fata de harta si ceilalti actori
+    Interactions,       // monede, iesiri, tile-uri letale
+    MapDraw,            // MapRenderer::draw
+    Display,            // window->display(), inclusiv asteptarea vsync
+    Count
+};
+inline constexpr std::size_t ProfilePhaseCount = static_cast<std::size_t>(ProfilePhase::Count);
+
+// Durata fiecarei faze pe ultimele History esantioane (un esantion = un tick pentru fazele simularii,
+// un frame pentru cele ale ferestrei). Fiecare faza e scrisa de un singur fir, dar poate fi citita de
+// oricare: esantioanele sunt atomice, deci overlay-ul nu blocheaza simularea.
+// Se foloseste doar prin macro-urile de mai jos; fara FBWG_PROFILER ele nu genereaza niciun cod.
+class Profiler {
+public:
+    static constexpr std::size_t History = 240;
+
+    struct Stats {
+        double last = 0.0;
+        double p50 = 0.0;
+        double p99 = 0.0;
+    };
+
+    static Profiler& instance();
+    static const char* name(ProfilePhase phase);
+
+    // firul care detine faza: adauga la esantionul in curs (o faza se poate masura pe bucati)
+    void add(ProfilePhase phase, double seconds) { tracks[index(phase)].pending += seconds; }
+    // firul care detine fazele [first, last]: inchide esantioanele in curs si incepe altele
+    void commit(ProfilePhase first, ProfilePhase last);
+
+    // orice fir: secunde; age 0 = cel mai nou esantion, 0 daca nu exista
+    double sample(ProfilePhase phase, std::size_t age) const;
+    Stats stats(ProfilePhase phase) const;
+
+private:
+    struct Track {
+        double pending = 0.0;
+        std::array<std::atomic<float>, History> samples{};
+        // cate esantioane s-au scris vreodata; ultimul e la (written - 1) % History
+        std::atomic<std::uint64_t> written{0};
+    };
+    std::array<Track, ProfilePhaseCount> tracks;
+
+    static std::size_t index(ProfilePhase phase) { return static_cast<std::size_t>(phase); }
+};
+
+// masoara blocul in care e declarat si il adauga la faza
+class ProfileScope {
+private:
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ProfileScope(ProfilePhase p) : phase(p), start(std::chrono::steady_clock::now()) {}
+    ~ProfileScope() {
+        Profiler::instance().add(phase, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#ifdef FBWG_PROFILER
+#define FBWG_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FBWG_PROFILE_CONCAT(a, b) FBWG_PROFILE_CONCAT_IMPL(a, b)
+#define FBWG_PROFILE_SCOPE(phase) const ProfileScope FBWG_PROFILE_CONCAT(profileScope_, __LINE__)(phase)
+#define FBWG_PROFILE_COMMIT(first, last) Profiler::instance().commit(first, last)
+#else
+#define FBWG_PROFILE_SCOPE(phase) ((void)0)
+#define FBWG_PROFILE_COMMIT(first, last) ((void)0)
+#endif
+
+#endif // OOP_PROFILER_H
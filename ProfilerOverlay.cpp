@@ -0,0 +1,99 @@
+#include "ProfilerOverlay.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+    constexpr float Padding = 8.f;
+    constexpr float GraphHeight = 90.f;
+    constexpr float LineHeight = 16.f;
+    constexpr unsigned TextSize = 13;
+
+    std::string milliseconds(double seconds) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%6.3f", seconds * 1000.0);
+        return buf;
+    }
+}
+
+sf::Color ProfilerOverlay::colorOf(std::size_t phase) {
+    static const std::array<sf::Color, ProfilePhaseCount> colors = {
+        sf::Color(200, 200, 200), sf::Color(80, 160, 255), sf::Color(120, 220, 120), sf::Color(255, 200, 60),
+        sf::Color(255, 110, 80), sf::Color(200, 120, 255), sf::Color(80, 220, 220), sf::Color(255, 120, 180),
+    };
+    return colors[phase];
+}
+
+void ProfilerOverlay::init(const sf::Font& font, unsigned int windowWidth, float top) {
+    const float width = std::min(360.f, static_cast<float>(windowWidth) - 2.f * Padding);
+    const float left = static_cast<float>(windowWidth) - width - Padding;
+    const float height = GraphHeight + (ProfilePhaseCount + 2) * LineHeight + 3.f * Padding;
+
+    background.setPosition(left, top + Padding);
+    background.setSize({width, height});
+    background.setFillColor(sf::Color(0, 0, 0, 170));
+
+    graphFrame.setPosition(left + Padding, top + 2.f * Padding);
+    graphFrame.setSize({width - 2.f * Padding, GraphHeight});
+    graphFrame.setFillColor(sf::Color::Transparent);
+    graphFrame.setOutlineColor(sf::Color(255, 255, 255, 60));
+    graphFrame.setOutlineThickness(1.f);
+
+    const auto setup = [&](sf::Text& text, sf::Color color, float row) {
+        text.setFont(font);
+        text.setCharacterSize(TextSize);
+        text.setFillColor(color);
+        text.setPosition(left + Padding, top + 3.f * Padding + GraphHeight + row * LineHeight);
+    };
+    for (std::size_t p = 0; p < ProfilePhaseCount; ++p) setup(phaseTexts[p], colorOf(p), static_cast<float>(p));
+    setup(latencyText, sf::Color::White, static_cast<float>(ProfilePhaseCount));
+    setup(scaleText, sf::Color(255, 255, 255, 160), static_cast<float>(ProfilePhaseCount) + 1.f);
+}
+
+void ProfilerOverlay::update(double lastInputLatency, double meanInputLatency) {
+    if (!visible) return;
+    const Profiler& profiler = Profiler::instance();
+
+    // scara graficului: cel mai mare p99, ca un varf izolat sa nu turteasca restul
+    double scale = 0.001;
+    for (std::size_t p = 0; p < ProfilePhaseCount; ++p) {
+        const ProfilePhase phase = static_cast<ProfilePhase>(p);
+        const Profiler::Stats s = profiler.stats(phase);
+        scale = std::max(scale, s.p99);
+        char label[24];
+        std::snprintf(label, sizeof(label), "%-15s", Profiler::name(phase));
+        phaseTexts[p].setString(std::string(label) + "p50 " + milliseconds(s.p50) + "  p99 " + milliseconds(s.p99) + " ms");
+    }
+    latencyText.setString("input->display " + milliseconds(lastInputLatency) + " ms (mean " +
+                          milliseconds(meanInputLatency) + ")");
+    scaleText.setString("graph: " + std::to_string(Profiler::History) + " samples, top =" + milliseconds(scale) + " ms");
+
+    // esantioanele mai vechi in stanga; valorile peste scara sunt taiate la marginea de sus
+    const sf::Vector2f origin = graphFrame.getPosition();
+    const sf::Vector2f size = graphFrame.getSize();
+    const float step = size.x / static_cast<float>(Profiler::History - 1);
+    graph.clear();
+    for (std::size_t p = 0; p < ProfilePhaseCount; ++p) {
+        const ProfilePhase phase = static_cast<ProfilePhase>(p);
+        const sf::Color color = colorOf(p);
+        const auto point = [&](std::size_t age) {
+            const float v = static_cast<float>(std::min(profiler.sample(phase, age) / scale, 1.0));
+            const float x = origin.x + size.x - static_cast<float>(age) * step;
+            return sf::Vertex({x, origin.y + size.y * (1.f - v)}, color);
+        };
+        for (std::size_t age = 0; age + 1 < Profiler::History; ++age) {
+            graph.append(point(age));
+            graph.append(point(age + 1));
+        }
+    }
+}
+
+void ProfilerOverlay::render(sf::RenderTarget& target) const {
+    if (!visible) return;
+    target.draw(background);
+    target.draw(graphFrame);
+    target.draw(graph);
+    for (const sf::Text& text : phaseTexts) target.draw(text);
+    target.draw(latencyText);
+    target.draw(scaleText);
+}
@@ -0,0 +1,33 @@
+#ifndef OOP_PROFILEROVERLAY_H
+#define OOP_PROFILEROVERLAY_H
+
+#include <array>
+#include <SFML/Graphics.hpp>
+#include "Profiler.h"
+
+// Panoul profiler-ului, sub bara HUD-ului: graficul ultimelor esantioane ale fiecarei faze si
+// p50/p99 pe faza, plus latenta input -> ecran. Exista doar in build-urile cu FBWG_PROFILER.
+class ProfilerOverlay {
+private:
+    bool visible = false;
+    sf::RectangleShape background;
+    sf::RectangleShape graphFrame;
+    // cate o linie franta per faza, ca segmente (sf::Lines) intr-un singur draw
+    sf::VertexArray graph{sf::Lines};
+    std::array<sf::Text, ProfilePhaseCount> phaseTexts;
+    sf::Text scaleText;
+    sf::Text latencyText;
+
+    static sf::Color colorOf(std::size_t phase);
+
+public:
+    // top: sub ce se aseaza panoul (bara HUD-ului)
+    void init(const sf::Font& font, unsigned int windowWidth, float top);
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+    // reface graficul si textele din esantioanele curente; latentele in secunde
+    void update(double lastInputLatency, double meanInputLatency);
+    void render(sf::RenderTarget& target) const;
+};
+
+#endif // OOP_PROFILEROVERLAY_H
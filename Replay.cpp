@@ -0,0 +1,146 @@
+#include "Replay.h"
+#include "GameExceptions.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr char Magic[4] = {'F', 'B', 'W', 'R'};
+    constexpr unsigned BitsPerCharacter = 3;
+
+    void requireLittleEndian(const std::string& path) {
+        if constexpr (std::endian::native != std::endian::little) {
+            throw ResourceLoadError("Replays are little-endian only: " + path);
+        }
+    }
+}
+
+std::string Replay::levelId(LevelType level) {
+    return std::to_string(static_cast<int>(level) + 1);
+}
+
+Replay::Mask Replay::encode(const std::vector<CharacterInput>& inputs) {
+    Mask mask = 0;
+    const std::size_t n = std::min(inputs.size(), MaxCharacters);
+    for (std::size_t i = 0; i < n; ++i) {
+        const unsigned bits = (inputs[i].left ? 1u : 0u) | (inputs[i].right ? 2u : 0u) | (inputs[i].jump ? 4u : 0u);
+        mask = static_cast<Mask>(mask | bits << (i * BitsPerCharacter));
+    }
+    return mask;
+}
+
+void Replay::decode(Mask mask, std::vector<CharacterInput>& inputs) {
+    const std::size_t n = std::min(inputs.size(), MaxCharacters);
+    for (std::size_t i = 0; i < n; ++i) {
+        const unsigned bits = mask >> (i * BitsPerCharacter);
+        inputs[i].left = (bits & 1u) != 0;
+        inputs[i].right = (bits & 2u) != 0;
+        inputs[i].jump = (bits & 4u) != 0;
+    }
+}
+
+void Replay::record(const std::vector<CharacterInput>& inputs) {
+    Mask mask = encode(inputs);
+    if (restartPending) {
+        mask |= RestartBit;
+        restartPending = false;
+    }
+    ticks.push_back(mask);
+}
+
+void Replay::rewind() {
+    if (ticks.empty()) return;
+    // inapoi la starea de imediat dupa restart: restartul ramane de aplicat inaintea tick-ului urmator
+    if (ticks.back() & RestartBit) restartPending = true;
+    ticks.pop_back();
+}
+
+void Replay::startLevel(Simulation& sim) const {
+    if (level.size() == 1 && level[0] >= '1' && level[0] <= '4') {
+        sim.startLevel(static_cast<LevelType>(level[0] - '1'));
+    } else {
+        sim.startLevel(level);
+    }
+}
+
+std::size_t Replay::play(Simulation& sim) const {
+    std::vector<CharacterInput> inputs(sim.getCharacters().size());
+    std::size_t restarts = 0;
+    for (const Mask mask : ticks) {
+        if (mask & RestartBit) {
+            sim.restart();
+            ++restarts;
+        }
+        decode(mask, inputs);
+        sim.step(inputs);
+    }
+    return restarts;
+}
+
+void Replay::save(const std::string& path) const {
+    requireLittleEndian(path);
+
+    std::vector<ReplayRun> runs;
+    for (const Mask mask : ticks) {
+        if (!runs.empty() && runs.back().mask == mask) ++runs.back().length;
+        else runs.push_back(ReplayRun{mask, 0, 1});
+    }
+
+    ReplayHeader header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.tickRate = tickRate;
+    header.tickCount = static_cast<std::uint32_t>(ticks.size());
+    header.runCount = static_cast<std::uint32_t>(runs.size());
+    header.levelLength = static_cast<std::uint32_t>(level.size());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw ResourceLoadError("Failed to create replay: " + path);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(level.data(), static_cast<std::streamsize>(level.size()));
+    out.write(reinterpret_cast<const char*>(runs.data()), static_cast<std::streamsize>(runs.size() * sizeof(ReplayRun)));
+    if (!out) {
+        throw ResourceLoadError("Failed to write replay: " + path);
+    }
+}
+
+Replay Replay::load(const std::string& path) {
+    requireLittleEndian(path);
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw ResourceLoadError("Failed to open replay: " + path);
+    }
+    ReplayHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw ResourceLoadError(path + ": file too small for a replay");
+    }
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+        throw ResourceLoadError(path + ": not a version " + std::to_string(Version) + " replay");
+    }
+    if (header.tickRate == 0 || header.levelLength == 0 || header.runCount > header.tickCount) {
+        throw ResourceLoadError(path + ": corrupt replay header");
+    }
+
+    Replay replay(std::string(header.levelLength, '\0'), static_cast<int>(header.tickRate));
+    std::vector<ReplayRun> runs(header.runCount);
+    if (!in.read(replay.level.data(), static_cast<std::streamsize>(replay.level.size())) ||
+        !in.read(reinterpret_cast<char*>(runs.data()), static_cast<std::streamsize>(runs.size() * sizeof(ReplayRun)))) {
+        throw ResourceLoadError(path + ": truncated replay");
+    }
+
+    replay.ticks.reserve(header.tickCount);
+    for (const ReplayRun& run : runs) {
+        if (run.length > header.tickCount - replay.ticks.size()) {
+            throw ResourceLoadError(path + ": replay runs exceed the tick count");
+        }
+        replay.ticks.insert(replay.ticks.end(), run.length, run.mask);
+    }
+    if (replay.ticks.size() != header.tickCount) {
+        throw ResourceLoadError(path + ": replay runs do not match the tick count");
+    }
+    return replay;
+}
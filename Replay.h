@@ -0,0 +1,79 @@
+#ifndef OOP_REPLAY_H
+#define OOP_REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Simulation.h"
+
+// Inregistrarea comenzilor unui joc, tick cu tick: acelasi nivel + aceleasi comenzi dau exact aceeasi
+// stare, deci un replay reproduce un bug si e o sarcina realista pentru benchmark-ul fizicii.
+// Fisier .fbwr, little-endian:
+//   [ReplayHeader, 32 bytes][levelLength bytes: nivelul][runCount x ReplayRun]
+// Comenzile se schimba rar fata de numarul de tick-uri, deci se scriu ca run-uri (masca, lungime).
+// Simularea nu foloseste numere aleatoare (nici NPC-urile), deci nivelul si comenzile determina totul: fara seed.
+struct ReplayHeader {
+    char magic[4];                 // "FBWR"
+    std::uint32_t version;
+    std::uint32_t tickRate;
+    std::uint32_t reserved0;       // 0; locul fostului seed, scris mereu 0 si necitit
+    std::uint32_t tickCount;
+    std::uint32_t runCount;
+    std::uint32_t levelLength;
+    std::uint32_t reserved1;
+};
+static_assert(sizeof(ReplayHeader) == 32, "replay header layout changed");
+
+struct ReplayRun {
+    std::uint16_t mask;
+    std::uint16_t reserved;
+    std::uint32_t length;
+};
+static_assert(sizeof(ReplayRun) == 8, "replay run layout changed");
+
+class Replay {
+public:
+    static constexpr std::uint32_t Version = 1;
+    static constexpr const char* Extension = ".fbwr";
+    // cate 3 biti (stanga, dreapta, saritura) pentru fiecare din primele 4 personaje;
+    // RestartBit: nivelul a fost repornit inaintea acestui tick
+    using Mask = std::uint16_t;
+    static constexpr std::size_t MaxCharacters = 4;
+    static constexpr Mask RestartBit = 0x8000;
+
+    // "1".."4" pentru nivelele incorporate, altfel calea unui fisier de nivel
+    std::string level = "1";
+    std::uint32_t tickRate = Simulation::DefaultTickRate;
+    std::vector<Mask> ticks;
+
+    Replay() = default;
+    Replay(std::string levelId, int rate) : level(std::move(levelId)), tickRate(static_cast<std::uint32_t>(rate)) {}
+
+    static std::string levelId(LevelType level);
+    static Mask encode(const std::vector<CharacterInput>& inputs);
+    // scrie comenzile din mask peste inputs, fara sa-i schimbe dimensiunea
+    static void decode(Mask mask, std::vector<CharacterInput>& inputs);
+
+    // apelate de cine ruleaza simularea, in aceeasi ordine ca Simulation::restart/step
+    void recordRestart() { restartPending = true; }
+    void record(const std::vector<CharacterInput>& inputs);
+    // rewind cu un tick: starea revine exact la cea de dinainte, deci tick-ul dispare din inregistrare
+    void rewind();
+    bool empty() const { return ticks.empty(); }
+
+    // porneste pe sim nivelul inregistrat
+    void startLevel(Simulation& sim) const;
+    // ruleaza toate tick-urile pe sim, pornit deja cu startLevel; intoarce cate restart-uri au fost
+    std::size_t play(Simulation& sim) const;
+
+    // arunca ResourceLoadError la erori de scriere/citire sau la un fisier corupt
+    void save(const std::string& path) const;
+    static Replay load(const std::string& path);
+
+private:
+    bool restartPending = false;
+};
+
+#endif // OOP_REPLAY_H
@@ -0,0 +1,112 @@
+#include "RewindBuffer.h"
+#include "GameExceptions.h"
+#include <algorithm>
+
+namespace {
+    // o diferenta are nevoie de cel putin atatea zero-uri la rand ca sa merite un nou run
+    constexpr std::size_t MinZeroRun = 2;
+
+    void appendVarint(StateBytes::Buffer& out, std::size_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    std::size_t readVarint(const std::uint8_t*& in) {
+        std::size_t value = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            const std::uint8_t b = *in++;
+            value |= static_cast<std::size_t>(b & 0x7f) << shift;
+            if ((b & 0x80) == 0) return value;
+        }
+    }
+}
+
+RewindBuffer::RewindBuffer(std::size_t capacity, std::size_t interval)
+    : keyframeInterval(interval)
+{
+    if (interval == 0 || capacity == 0) {
+        throw GameError("Rewind buffer needs a positive capacity and keyframe interval");
+    }
+    // cel putin doua grupuri: cand unul dispare, ramane istoria celuilalt
+    const std::size_t groups = std::max<std::size_t>(2, (capacity + interval - 1) / interval);
+    slots.resize(groups * interval);
+}
+
+void RewindBuffer::clear() {
+    first = 0;
+    count = 0;
+}
+
+// Format: [lungimea starii][(zero-uri, n, n bytes XOR)...], lungimile ca varint
+void RewindBuffer::encodeDelta(const StateBytes::Buffer& state, const StateBytes::Buffer& key, StateBytes::Buffer& out) {
+    out.clear();
+    const std::size_t n = state.size();
+    appendVarint(out, n);
+    const auto diff = [&](std::size_t i) {
+        return static_cast<std::uint8_t>(state[i] ^ (i < key.size() ? key[i] : 0));
+    };
+    std::size_t i = 0;
+    while (i < n) {
+        const std::size_t zerosFrom = i;
+        while (i < n && diff(i) == 0) ++i;
+        if (i == n) break;
+        const std::size_t literalFrom = i;
+        // literalul se termina la primul sir de MinZeroRun zero-uri
+        std::size_t zeros = 0;
+        while (i < n && zeros < MinZeroRun) {
+            zeros = diff(i) == 0 ? zeros + 1 : 0;
+            ++i;
+        }
+        const std::size_t literalEnd = i - zeros;
+        appendVarint(out, literalFrom - zerosFrom);
+        appendVarint(out, literalEnd - literalFrom);
+        for (std::size_t k = literalFrom; k < literalEnd; ++k) out.push_back(diff(k));
+        i = literalEnd;
+    }
+}
+
+void RewindBuffer::decodeDelta(const StateBytes::Buffer& delta, const StateBytes::Buffer& key, StateBytes::Buffer& out) {
+    const std::uint8_t* in = delta.data();
+    const std::uint8_t* const end = in + delta.size();
+    const std::size_t n = readVarint(in);
+    out.assign(key.begin(), key.begin() + static_cast<std::ptrdiff_t>(std::min(n, key.size())));
+    out.resize(n, 0);
+    std::size_t pos = 0;
+    while (in < end) {
+        pos += readVarint(in);
+        const std::size_t literal = readVarint(in);
+        for (std::size_t k = 0; k < literal; ++k) out[pos + k] ^= in[k];
+        in += literal;
+        pos += literal;
+    }
+}
+
+void RewindBuffer::push(const StateBytes::Buffer& state) {
+    if (count == slots.size()) {
+        // plin: cel mai vechi grup pleaca intreg, ca sa nu ramana diferente fara keyframe
+        first += keyframeInterval;
+        count -= keyframeInterval;
+    }
+    const std::uint64_t index = first + count;
+    if (isKeyframe(index)) slot(index) = state;
+    else encodeDelta(state, keyframeOf(index), slot(index));
+    ++count;
+}
+
+bool RewindBuffer::stepBack(StateBytes::Buffer& out) {
+    if (count < 2) return false;
+    --count;
+    const std::uint64_t index = first + count - 1;
+    if (isKeyframe(index)) out = slot(index);
+    else decodeDelta(slot(index), keyframeOf(index), out);
+    return true;
+}
+
+std::size_t RewindBuffer::bytes() const {
+    std::size_t total = 0;
+    for (std::size_t k = 0; k < count; ++k) total += slots[(first + k) % slots.size()].size();
+    return total;
+}
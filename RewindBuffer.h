@@ -0,0 +1,46 @@
+#ifndef OOP_REWINDBUFFER_H
+#define OOP_REWINDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "StateBytes.h"
+
+// Istoria ultimelor tick-uri pentru rewind: cate o stare (Simulation::saveState) pe tick, intr-un
+// buffer circular. O stare din keyframeInterval e keyframe, pastrat intreg; celelalte sunt XOR fata
+// de keyframe-ul lor, cu sirurile de zero-uri (campurile neschimbate, bitii de semn si exponent)
+// scrise doar ca lungime. Refacerea unui tick decodeaza o singura diferenta, nu un lant.
+// Cand se umple, dispare cel mai vechi grup keyframe + diferente, deci istoria incepe mereu cu un keyframe.
+class RewindBuffer {
+private:
+    std::size_t keyframeInterval;
+    // starea cu indexul absolut i sta in slots[i % slots.size()]; vectorii isi pastreaza capacitatea
+    std::vector<StateBytes::Buffer> slots;
+    // indexul absolut al celei mai vechi stari si cate stari sunt
+    std::uint64_t first = 0;
+    std::size_t count = 0;
+
+    bool isKeyframe(std::uint64_t index) const { return index % keyframeInterval == 0; }
+    StateBytes::Buffer& slot(std::uint64_t index) { return slots[index % slots.size()]; }
+    const StateBytes::Buffer& keyframeOf(std::uint64_t index) const {
+        return slots[(index - index % keyframeInterval) % slots.size()];
+    }
+    static void encodeDelta(const StateBytes::Buffer& state, const StateBytes::Buffer& key, StateBytes::Buffer& out);
+    static void decodeDelta(const StateBytes::Buffer& delta, const StateBytes::Buffer& key, StateBytes::Buffer& out);
+
+public:
+    // capacity: cate tick-uri se pastreaza (rotunjit in sus la un multiplu de keyframeInterval)
+    explicit RewindBuffer(std::size_t capacity, std::size_t keyframeInterval);
+
+    void clear();
+    // starea de la sfarsitul urmatorului tick
+    void push(const StateBytes::Buffer& state);
+    // uita cea mai noua stare si scrie in out pe cea de dinaintea ei; false daca nu mai e istorie
+    bool stepBack(StateBytes::Buffer& out);
+
+    std::size_t size() const { return count; }
+    // bytes ocupati de starile pastrate (fara capacitatea nefolosita a vectorilor)
+    std::size_t bytes() const;
+};
+
+#endif // OOP_REWINDBUFFER_H
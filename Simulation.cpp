@@ -0,0 +1,786 @@
+#include "Simulation.h"
+#include "MathUtils.h"
+#include "CharacterFactory.h"
+#include "GameExceptions.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+    inline bool intersects(const sf::FloatRect& a, const sf::FloatRect& b) {
+        return a.intersects(b);
+    }
+
+    // scoate actorul i dintr-un obstacol in care a fost impins (platformele mobile)
+    inline void resolveCollision(ActorStore& actors, ActorStore::Id i, sf::FloatRect& cb, const sf::FloatRect& rect) {
+        float charCenterX = cb.left + cb.width * 0.5f;
+        float rectCenterX = rect.left + rect.width * 0.5f;
+        float charCenterY = cb.top + cb.height * 0.5f;
+        float rectCenterY = rect.top + rect.height * 0.5f;
+
+        float dx = charCenterX - rectCenterX;
+        float dy = charCenterY - rectCenterY;
+
+        float intersectX = (cb.width + rect.width) * 0.5f - std::abs(dx);
+        float intersectY = (cb.height + rect.height) * 0.5f - std::abs(dy);
+
+        if (intersectX > 0.0f && intersectY > 0.0f) {
+            if (intersectX < intersectY) {
+                // Lateral/Horizontal resolution
+                if (dx > 0.0f) {
+                    actors.setPosition(i, {rect.left + rect.width, cb.top});
+                } else {
+                    actors.setPosition(i, {rect.left - cb.width, cb.top});
+                }
+            } else {
+                // Vertical resolution
+                if (dy > 0.0f) {
+                    actors.setPosition(i, {cb.left, rect.top + rect.height});
+                    actors.stopVerticalMovement(i);
+                } else {
+                    actors.setPosition(i, {cb.left, rect.top - cb.height});
+                    actors.setOnGround(i, true);
+                }
+            }
+            cb = actors.bounds(i);
+        }
+    }
+
+    // actori (sau insule de actori) per bucata de lucru in buclele paralele: sub atat, bucla ruleaza
+    // pe firul curent; o multime de cateva sute de actori se imparte deja intre fire
+    constexpr std::size_t ParallelGrain = 32;
+
+    // toleranta de contact: o suprapunere mai mica de atat (rotunjire float) conteaza ca atingere
+    constexpr float ContactSkin = 0.01f;
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+    // intervalul de timp [tIn, tOut] (in fractiuni din deplasare) in care segmentul a se suprapune
+    // cu b pe o axa, la viteza v; false daca pe aceasta axa nu se ating niciodata
+    inline bool sweepAxis(float aMin, float aSize, float bMin, float bSize, float v, float& tIn, float& tOut) {
+        const float aMax = aMin + aSize;
+        const float bMax = bMin + bSize;
+        if (v == 0.f) {
+            // fara miscare pe axa: trebuie sa se suprapuna deja (simpla atingere nu blocheaza)
+            if (aMax <= bMin + ContactSkin || aMin >= bMax - ContactSkin) return false;
+            tIn = -Infinity;
+            tOut = Infinity;
+            return true;
+        }
+        float gap = v > 0.f ? bMin - aMax : aMin - bMax;
+        const float through = v > 0.f ? bMax - aMin : aMax - bMin;
+        if (gap < 0.f && gap > -ContactSkin) gap = 0.f;
+        const float speed = std::abs(v);
+        tIn = gap / speed;
+        tOut = through / speed;
+        return true;
+    }
+
+    // a si b se suprapun deja: contactul e pe axa cu patrunderea cea mai mica, normala spre a.
+    // Blocheaza (toi 0) doar daca d ar adanci patrunderea; iesirea din obstacol ramane libera
+    inline bool overlapContact(const sf::FloatRect& a, const sf::Vector2f& d, const sf::FloatRect& b,
+                               float& toi, sf::Vector2f& normal) {
+        const float penX = std::min(a.left + a.width - b.left, b.left + b.width - a.left);
+        const float penY = std::min(a.top + a.height - b.top, b.top + b.height - a.top);
+        sf::Vector2f n;
+        if (penY <= penX) n = {0.f, a.top + a.height * 0.5f < b.top + b.height * 0.5f ? -1.f : 1.f};
+        else n = {a.left + a.width * 0.5f < b.left + b.width * 0.5f ? -1.f : 1.f, 0.f};
+        if (d.x * n.x + d.y * n.y >= 0.f) return false;
+        toi = 0.f;
+        normal = n;
+        return true;
+    }
+
+    // swept AABB: momentul primului contact (0..1) al cutiei a deplasata cu d fata de b statica,
+    // si normala suprafetei lovite; false daca nu se ating in acest pas. Daca sunt deja suprapuse
+    // (ex: impins de o platforma intr-un tile), suprapunerea conteaza ca atingere la momentul 0
+    inline bool sweepAabb(const sf::FloatRect& a, const sf::Vector2f& d, const sf::FloatRect& b,
+                          float& toi, sf::Vector2f& normal) {
+        float txIn, txOut, tyIn, tyOut;
+        if (!sweepAxis(a.left, a.width, b.left, b.width, d.x, txIn, txOut)) return false;
+        if (!sweepAxis(a.top, a.height, b.top, b.height, d.y, tyIn, tyOut)) return false;
+
+        const float entry = std::max(txIn, tyIn);
+        const float exit = std::min(txOut, tyOut);
+        if (entry > exit || entry > 1.f) return false;
+        if (entry < 0.f) {
+            // exit <= 0: obstacolul a ramas in urma, nu se mai ating
+            return exit > 0.f && overlapContact(a, d, b, toi, normal);
+        }
+
+        toi = entry;
+        // la egalitate (colt) se alege axa verticala, ca personajul sa aterizeze, nu sa se agate
+        if (tyIn >= txIn) normal = {0.f, d.y > 0.f ? -1.f : 1.f};
+        else normal = {d.x > 0.f ? -1.f : 1.f, 0.f};
+        return true;
+    }
+
+    // distanta pana la care un actor inca sta pe suprafata de sub el (platforma sau alt actor)
+    constexpr float SupportEpsilon = 1.5f;
+
+    // a sta pe b: se suprapun pe orizontala si fundul lui a e (aproape) pe varful lui b
+    inline bool standsOn(const sf::FloatRect& a, const sf::FloatRect& b) {
+        const bool horizontally = (a.left < b.left + b.width) && (a.left + a.width > b.left);
+        return horizontally && std::abs((a.top + a.height) - b.top) <= SupportEpsilon;
+    }
+
+    inline sf::FloatRect sweptArea(const sf::FloatRect& a, const sf::Vector2f& d) {
+        const float left = std::min(a.left, a.left + d.x);
+        const float top = std::min(a.top, a.top + d.y);
+        return sf::FloatRect(left, top, a.width + std::abs(d.x), a.height + std::abs(d.y));
+    }
+
+    // pentru fiecare element, tipurile de tile prin care nu poate trece (solide sau jumatate solide)
+    constexpr std::array<TileMask, ElementCount> blockingTiles = {
+        CollisionRules::tilesWith(Element::Fire, CollisionRules::Blocking),
+        CollisionRules::tilesWith(Element::Water, CollisionRules::Blocking),
+        CollisionRules::tilesWith(Element::Neutral, CollisionRules::Blocking),
+        CollisionRules::tilesWith(Element::Air, CollisionRules::Blocking),
+    };
+
+    // pentru fiecare element, tipurile de tile cu care interactioneaza (restul sunt sarite)
+    constexpr std::array<TileMask, ElementCount> interactingTiles = {
+        CollisionRules::tilesWith(Element::Fire, CollisionRules::Any),
+        CollisionRules::tilesWith(Element::Water, CollisionRules::Any),
+        CollisionRules::tilesWith(Element::Neutral, CollisionRules::Any),
+        CollisionRules::tilesWith(Element::Air, CollisionRules::Any),
+    };
+
+    // NPC-urile nu iau monede si nu ies din nivel: doar tile-urile care le omoara
+    constexpr CollisionRules::Flags Lethal = CollisionRules::Deadly | CollisionRules::TopHalfDeadly;
+    constexpr std::array<TileMask, ElementCount> lethalTiles = {
+        CollisionRules::tilesWith(Element::Fire, Lethal),
+        CollisionRules::tilesWith(Element::Water, Lethal),
+        CollisionRules::tilesWith(Element::Neutral, Lethal),
+        CollisionRules::tilesWith(Element::Air, Lethal),
+    };
+}
+
+Simulation::Simulation(int mapW, int mapH, int ticksPerSecond)
+    : map(mapW, mapH), tickRate(ticksPerSecond)
+{
+    if (ticksPerSecond <= 0) {
+        throw GameError("Simulation tick rate must be positive");
+    }
+    tickDt = 1.f / static_cast<float>(ticksPerSecond);
+}
+
+Simulation::Simulation(const Simulation& other)
+    : map(other.map),
+      actors(other.actors),
+      pristineActors(other.pristineActors),
+      charactersAtExit(other.charactersAtExit),
+      spawnPositions(other.spawnPositions),
+      tickRate(other.tickRate),
+      tickDt(other.tickDt),
+      tickCount(other.tickCount),
+      levelEpoch(other.levelEpoch),
+      tileEdits(other.tileEdits),
+      tileEditsRevision(other.tileEditsRevision),
+      currentLevel(other.currentLevel),
+      won(other.won),
+      gameOver(other.gameOver),
+      totalCoins(other.totalCoins),
+      collectedCoins(other.collectedCoins)
+{
+    // deep copy prin clone(); fatadele se leaga apoi de copia store-ului
+    for (const auto& ch : other.characters) {
+        if (ch) characters.push_back(ch->clone());
+        else characters.push_back(nullptr);
+    }
+    bindCharacters();
+}
+
+void Simulation::bindCharacters() noexcept {
+    for (size_t i = 0; i < characters.size(); ++i) {
+        if (characters[i]) characters[i]->bind(actors, i);
+    }
+}
+
+//operator de atribuire prin copy and swap
+Simulation& Simulation::operator=(Simulation other) {
+    this->swap(other);
+    return *this;
+}
+
+void Simulation::initializeCharacters() {
+    characters.clear();
+    actors.clear();
+    spawnPositions.clear();
+
+    // ordinea PlayerType: Fireboy, Watergirl, Earthboy, Airgirl
+    const std::array<std::pair<PlayerType, sf::Vector2f>, 4> roster = {{
+        {PlayerType::Fireboy, map.respawnWorldPosForFire()},
+        {PlayerType::Watergirl, map.respawnWorldPosForWater()},
+        {PlayerType::Earthboy, map.respawnWorldPosForEarth()},
+        {PlayerType::Airgirl, map.respawnWorldPosForAir()},
+    }};
+    // personajul i este actorul i din store; NPC-urile vin dupa ele
+    for (const auto& [type, spawn] : roster) {
+        spawnPositions.push_back(spawn);
+        characters.push_back(CharacterFactory::createCharacter(type, spawn));
+        characters.back()->attach(actors);
+    }
+}
+
+ActorStore::Id Simulation::spawnNpc(Element element, const sf::Vector2f& position, const sf::Vector2f& hitbox) {
+    ActorStore::Actor a;
+    a.position = position;
+    a.size = hitbox;
+    a.element = element;
+    // intra si in snapshot-ul de restart, ca NPC-ul sa reapara la pozitia de spawn
+    pristineActors.add(a);
+    return actors.add(a);
+}
+
+void Simulation::beginLevel() {
+    // contorul e tinut de Map la incarcare, fara parcurgerea hartii
+    totalCoins = static_cast<int>(map.remainingCoins());
+    collectedCoins = 0;
+
+    initializeCharacters();
+
+    won = false;
+    gameOver = false;
+    charactersAtExit.assign(characters.size(), false);
+    // snapshot-ul pentru restart: doar vectorii store-ului, fara obiecte pe heap
+    pristineActors = actors;
+    tickCount = 0;
+    tileEdits.clear();
+    ++levelEpoch;
+}
+
+void Simulation::startLevel(LevelType level) {
+    currentLevel = level;
+    map.loadLevel(level);
+    beginLevel();
+}
+
+void Simulation::startLevel(const std::string& path) {
+    map.loadLevel(path);
+    beginLevel();
+}
+
+void Simulation::restart() {
+    // harta revine la snapshot-ul de dupa incarcare: doar chunk-urile modificate se anuleaza
+    map.restorePristine();
+    totalCoins = static_cast<int>(map.remainingCoins());
+    collectedCoins = 0;
+
+    // actorii revin la snapshot-ul de dupa spawn: copiere de vectori de aceeasi marime, fara alocari;
+    // fatadele raman legate de aceleasi Id-uri
+    actors = pristineActors;
+
+    // reset flags
+    won = false;
+    gameOver = false;
+    charactersAtExit.assign(characters.size(), false);
+    tickCount = 0;
+    tileEdits.clear();
+    ++levelEpoch;
+}
+
+void Simulation::applyInput(const std::vector<CharacterInput>& inputs, float dt) {
+    if (won || gameOver) return;
+
+    const size_t n = std::min(inputs.size(), actors.size());
+    for (size_t i = 0; i < n; ++i) {
+        const CharacterInput& in = inputs[i];
+        if (in.left) actors.moveLeft(i, dt);
+        if (in.right) actors.moveRight(i, dt);
+        if (in.jump) actors.jump(i);
+    }
+}
+
+void Simulation::update(float dt) {
+    if (won || gameOver) return;
+
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::Platforms);
+        map.update(dt);
+    }
+    sf::FloatRect world = map.worldBounds();
+
+    // reset exit flags
+    charactersAtExit.assign(characters.size(), false);
+
+    // gravitatia si deplasarea dorita pentru toti actorii, pe vectorii din store
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::Actors);
+        actors.integrate(dt);
+    }
+    // miscare cu swept AABB: oprita exact la primul contact cu un tile blocant, o platforma
+    // sau alt actor; cei purtati pe capul altora se misca dupa ei
+    prepareMoves();
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::Collisions);
+        // insulele nu se ating intre ele: in paralel, cu acelasi rezultat ca bucla pe moveOrder
+        JobSystem::shared().parallelFor(islandStart.size() - 1, ParallelGrain, [this](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                for (std::uint32_t a = islandStart[k]; a < islandStart[k + 1]; ++a) {
+                    moveActor(islandActors[a]);
+                }
+            }
+        });
+        actors.clampToWorld(world);
+    }
+
+    // collisions and exits/coins: toti actorii, in paralel; fiecare bucata de actori scrie doar
+    // in bufferul ei, iar harta, flag-urile si NPC-urile se modifica abia la aplicare
+    FBWG_PROFILE_SCOPE(ProfilePhase::Interactions);
+    interactionBuffers.resize((actors.size() + ParallelGrain - 1) / ParallelGrain);
+    for (auto& buffer : interactionBuffers) buffer.clear();
+    JobSystem::shared().parallelFor(actors.size(), ParallelGrain, [this](size_t begin, size_t end) {
+        std::vector<InteractionEvent>& buffer = interactionBuffers[begin / ParallelGrain];
+        for (size_t i = begin; i < end; ++i) {
+            if (i >= characters.size() || characters[i]) collectInteractions(i, buffer);
+        }
+    });
+    applyInteractions();
+
+    // win condition: all at exit and coins collected
+    if (!charactersAtExit.empty()) {
+        bool allAtExit = std::all_of(charactersAtExit.begin(), charactersAtExit.end(), [](bool v){ return v; });
+        if (allAtExit && collectedCoins >= totalCoins) {
+            won = true;
+        }
+    }
+}
+
+void Simulation::step(const std::vector<CharacterInput>& inputs) {
+    // starea de la inceputul tick-ului devine capatul "anterior" al interpolarii
+    actors.beginTick();
+    map.beginTick();
+    if (won || gameOver) return;
+
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::Actors);
+        applyInput(inputs, tickDt);
+    }
+    update(tickDt);
+    ++tickCount;
+    FBWG_PROFILE_COMMIT(ProfilePhase::Platforms, ProfilePhase::Interactions);
+}
+
+void Simulation::collectInteractions(ActorStore::Id id, std::vector<InteractionEvent>& out) const {
+    bool reachedExitForCharacter = false;
+    sf::FloatRect cb = actors.bounds(id);
+    // elementul e in store; in bucla doar citiri din tabel
+    const Element element = actors.element(id);
+    int maxCol = map.getWidth() - 1;
+    int maxRow = map.getHeight() - 1;
+    int leftCol = clamp<int>(static_cast<int>(cb.left / TileSize), 0, maxCol);
+    int rightCol = clamp<int>(static_cast<int>((cb.left + cb.width) / TileSize), 0, maxCol);
+    int topRow = clamp<int>(static_cast<int>(cb.top / TileSize), 0, maxRow);
+    int bottomRow = clamp<int>(static_cast<int>((cb.top + cb.height) / TileSize), 0, maxRow);
+
+    // doar celulele cu tile-uri care au reguli pentru acest element, din bitset-urile hartii
+    const auto& tiles = id < characters.size() ? interactingTiles : lethalTiles;
+    bool died = false;
+    map.forEachTileIn(tiles[static_cast<std::size_t>(element)], leftCol, topRow, rightCol, bottomRow,
+                      [&](int c, int r) {
+        TileType tt = map.getTileTypeAtGrid(c, r);
+        const CollisionRules::Flags rules = CollisionRules::lookup(element, tt);
+
+        // partile solide au fost deja tratate in moveActor
+
+//tratare speciala pt half fire si half water
+        if (rules & CollisionRules::BottomHalfSolid) {
+            sf::FloatRect tileRect(c * TileSize, r * TileSize, TileSize, TileSize);
+            const float halfH = TileSize * 0.5f;
+            sf::FloatRect topRect(tileRect.left, tileRect.top, tileRect.width, halfH);
+
+            if (intersects(cb, topRect)) { //partea de sus este letala/ok
+                if (rules & CollisionRules::TopHalfDeadly) {
+                    died = true;
+                    return false;
+                }
+            }
+        }
+
+        // moneda-zona activa e mijlocul jumatatii superioare; tabelul spune deja daca e a personajului
+        if (rules & CollisionRules::CollectCoin) {
+            sf::FloatRect tileRect(c * TileSize, r * TileSize, TileSize, TileSize);
+            const float halfH = TileSize * 0.5f;
+            const float quarterW = TileSize * 0.25f;
+            sf::FloatRect coinRect(tileRect.left + quarterW, tileRect.top,
+                                   TileSize * 0.5f, halfH);
+            if (intersects(cb, coinRect)) {
+                out.push_back({InteractionEvent::Kind::Coin, id, c, r, tt});
+            }
+        }
+
+        if (rules & CollisionRules::Deadly) {
+   //a atins un tile letal=> game over
+            died = true;
+            return false;
+        }
+
+        if (rules & CollisionRules::Exit) {
+            sf::FloatRect tileRect(c * TileSize, r * TileSize, TileSize, TileSize);
+            if (intersects(cb, tileRect)) reachedExitForCharacter = true;
+        }
+        return true;
+    });
+    if (died) out.push_back({InteractionEvent::Kind::Death, id});
+    else if (reachedExitForCharacter) out.push_back({InteractionEvent::Kind::Exit, id});
+}
+
+void Simulation::applyInteractions() {
+    // bufferele sunt pe bucati consecutive de Id-uri: luate in ordine, evenimentele vin in ordinea
+    // Id-urilor, oricum s-ar fi impartit bucatile intre fire
+    for (const auto& buffer : interactionBuffers) {
+        for (const InteractionEvent& e : buffer) {
+            switch (e.kind) {
+                case InteractionEvent::Kind::Coin:
+                    // doi pe aceeasi moneda in acelasi tick: o ia doar primul
+                    if (map.getTileTypeAtGrid(e.col, e.row) == e.tile) {
+                        collectedCoins++;
+                        map.setTileTypeAtGrid(e.col, e.row, TileType::Empty);
+                        tileEdits.push_back({e.col, e.row, TileType::Empty});
+                    }
+                    break;
+                case InteractionEvent::Kind::Death:
+                    if (e.actor < characters.size()) gameOver = true;
+                    else actors.set(e.actor, pristineActors.get(e.actor));
+                    break;
+                case InteractionEvent::Kind::Exit:
+                    charactersAtExit[e.actor] = true;
+                    break;
+            }
+        }
+    }
+}
+
+float Simulation::platformCarry(ActorStore::Id id) {
+    sf::FloatRect cb = actors.bounds(id);
+
+    // platformele s-au mutat deja in acest tick: personajul impins de una e scos din ea,
+    // iar cel care statea pe una la inceputul tick-ului e dus odata cu ea
+    float carry = 0.f;
+    bool riding = false;
+    // doar platformele din celulele din jur (spatial hash); un tile de margine acopera si pozitia
+    // de la inceputul tick-ului, platformele se misca mult mai putin de un tile pe tick
+    const PlatformStore& platforms = map.getPlatforms();
+    const float ts = static_cast<float>(TileSize);
+    const sf::FloatRect nearby(cb.left - ts, cb.top - ts, cb.width + 2.f * ts, cb.height + 2.f * ts);
+    platforms.forEachNear(nearby, [&](std::size_t p) {
+        const sf::FloatRect pb = platforms.bounds(p);
+        if (cb.intersects(pb)) {
+            resolveCollision(actors, id, cb, pb);
+            return;
+        }
+        const sf::FloatRect before = platforms.interpolatedBounds(p, 0.f);
+        if (!riding && standsOn(cb, before)) {
+            carry = platforms.lastDeltaX(p);
+            riding = true;
+        }
+    });
+    return carry;
+}
+
+void Simulation::prepareMoves() {
+    const std::size_t n = actors.size();
+    carryX.resize(n);
+    supporters.assign(n, NoSupport);
+    moveOrder.clear();
+
+    float reach = 0.f;
+    {
+        FBWG_PROFILE_SCOPE(ProfilePhase::PlatformCollisions);
+        JobSystem::shared().parallelFor(n, ParallelGrain, [this](size_t begin, size_t end) {
+            for (ActorStore::Id i = begin; i < end; ++i) carryX[i] = platformCarry(i);
+        });
+    }
+    FBWG_PROFILE_SCOPE(ProfilePhase::Collisions);
+    for (ActorStore::Id i = 0; i < n; ++i) {
+        reach = std::max(reach, std::abs(actors.displacement(i).x + carryX[i]));
+    }
+
+    // broadphase pe cutiile maturate: perechile de actori care se pot atinge in acest tick.
+    // Cel purtat pe cap se mai deplaseaza cu cel mult cat cel de sub el (reach), iar sprijinul
+    // se cauta la SupportEpsilon, deci cutiile se umfla cu atat
+    broadphase.resize(n);
+    for (ActorStore::Id i = 0; i < n; ++i) {
+        const sf::Vector2f d = actors.displacement(i) + sf::Vector2f(carryX[i], 0.f);
+        sf::FloatRect box = sweptArea(actors.bounds(i), d);
+        box.left -= reach;
+        box.width += 2.f * reach;
+        box.top -= SupportEpsilon;
+        box.height += 2.f * SupportEpsilon;
+        broadphase.setBox(i, box);
+    }
+    broadphase.update();
+
+    // cine sta pe capul cui, din pozitiile de la inceputul miscarii. Cei fara sprijin se misca
+    // primii, in ordinea Id-urilor; cei purtati dupa ei, de jos in sus, ca fiecare sa stie cat
+    // s-a deplasat deja cel de sub el
+    std::vector<ActorStore::Id>& riders = riderScratch;
+    riders.clear();
+    for (ActorStore::Id i = 0; i < n; ++i) {
+        // pe doi deodata: il poarta cel cu mai mult sub talpi
+        const sf::FloatRect cb = actors.bounds(i);
+        float bestOverlap = 0.f;
+        for (const std::uint32_t j : broadphase.neighbors(i)) {
+            const sf::FloatRect jb = actors.bounds(j);
+            if (!standsOn(cb, jb)) continue;
+            const float overlap = std::min(cb.left + cb.width, jb.left + jb.width) - std::max(cb.left, jb.left);
+            if (overlap > bestOverlap) {
+                bestOverlap = overlap;
+                supporters[i] = j;
+            }
+        }
+        if (supporters[i] == NoSupport) moveOrder.push_back(i);
+        else riders.push_back(i);
+    }
+    std::sort(riders.begin(), riders.end(), [this](ActorStore::Id a, ActorStore::Id b) {
+        const float bottomA = actors.position(a).y + actors.size(a).y;
+        const float bottomB = actors.position(b).y + actors.size(b).y;
+        return bottomA > bottomB || (bottomA == bottomB && a < b);
+    });
+    moveOrder.insert(moveOrder.end(), riders.begin(), riders.end());
+
+    // insulele: union-find pe perechile din broadphase (si cel purtat e vecin cu cel care il poarta)
+    islandParent.resize(n);
+    islandOf.resize(n);
+    for (std::uint32_t i = 0; i < n; ++i) islandParent[i] = i;
+    auto root = [this](std::uint32_t i) {
+        while (islandParent[i] != i) {
+            islandParent[i] = islandParent[islandParent[i]];
+            i = islandParent[i];
+        }
+        return i;
+    };
+    for (std::uint32_t i = 0; i < n; ++i) {
+        for (const std::uint32_t j : broadphase.neighbors(i)) {
+            if (j < i) continue;
+            const std::uint32_t a = root(i);
+            const std::uint32_t b = root(j);
+            if (a != b) islandParent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+    for (std::uint32_t i = 0; i < n; ++i) islandOf[i] = root(i);
+
+    // numerotate in ordinea primei aparitii in moveOrder, apoi asezate stabil (counting sort):
+    // islandParent devine intai radacina -> insula, apoi cursorul de scriere
+    constexpr std::uint32_t NoIsland = static_cast<std::uint32_t>(-1);
+    std::fill(islandParent.begin(), islandParent.end(), NoIsland);
+    std::uint32_t islands = 0;
+    for (const ActorStore::Id i : moveOrder) {
+        std::uint32_t& island = islandParent[islandOf[i]];
+        if (island == NoIsland) island = islands++;
+        islandOf[i] = island;
+    }
+    islandStart.assign(islands + 1, 0);
+    for (ActorStore::Id i = 0; i < n; ++i) ++islandStart[islandOf[i] + 1];
+    for (std::uint32_t k = 0; k < islands; ++k) islandStart[k + 1] += islandStart[k];
+    std::copy(islandStart.begin(), islandStart.end() - 1, islandParent.begin());
+    islandActors.resize(n);
+    for (const ActorStore::Id i : moveOrder) islandActors[islandParent[islandOf[i]]++] = i;
+}
+
+void Simulation::moveActor(ActorStore::Id id) {
+    sf::FloatRect cb = actors.bounds(id);
+    const PlatformStore& platforms = map.getPlatforms();
+
+    sf::Vector2f carry{carryX[id], 0.f};
+    // purtat pe capul altui actor: deplasarea lui orizontala din acest tick (s-a mutat deja)
+    if (const ActorStore::Id below = supporters[id]; below != NoSupport) {
+        carry.x += actors.position(below).x - actors.previousPosition(below).x;
+    }
+
+    sf::Vector2f d = actors.displacement(id) + carry;
+    const Element element = actors.element(id);
+    const TileMask blocking = blockingTiles[static_cast<std::size_t>(element)];
+    const int maxCol = map.getWidth() - 1;
+    const int maxRow = map.getHeight() - 1;
+    // fundul lumii e sol si in timpul miscarii, nu doar la clampToWorld de dupa: altfel un actor
+    // ar cadea sub el pentru un moment si cel de deasupra ar ateriza pe pozitia gresita
+    const sf::FloatRect world = map.worldBounds();
+    const sf::FloatRect worldFloor(world.left, world.top + world.height, world.width, static_cast<float>(TileSize));
+    bool landed = false;
+    bool hitCeiling = false;
+
+    // impact, alunecare pe suprafata, eventual al doilea impact (colt): cel mult 3 contacte pe tick
+    for (int pass = 0; pass < 3 && (d.x != 0.f || d.y != 0.f); ++pass) {
+        float toi = 1.f;
+        sf::Vector2f normal{};
+        bool hit = false;
+        auto consider = [&](const sf::FloatRect& obstacle) {
+            float t;
+            sf::Vector2f n;
+            if (!sweepAabb(cb, d, obstacle, t, n)) return;
+            // la acelasi moment, contactul vertical castiga (podeaua din tile-uri alaturate)
+            if (!hit || t < toi || (t == toi && n.y != 0.f)) {
+                toi = t;
+                normal = n;
+                hit = true;
+            }
+        };
+
+        // doar celulele atinse de cutia maturata, si doar tile-urile blocante pentru acest element
+        const sf::FloatRect area = sweptArea(cb, d);
+        const int leftCol = clamp<int>(static_cast<int>(area.left / TileSize), 0, maxCol);
+        const int rightCol = clamp<int>(static_cast<int>((area.left + area.width) / TileSize), 0, maxCol);
+        const int topRow = clamp<int>(static_cast<int>(area.top / TileSize), 0, maxRow);
+        const int bottomRow = clamp<int>(static_cast<int>((area.top + area.height) / TileSize), 0, maxRow);
+        map.forEachTileIn(blocking, leftCol, topRow, rightCol, bottomRow, [&](int c, int r) {
+            const CollisionRules::Flags rules = CollisionRules::lookup(element, map.getTileTypeAtGrid(c, r));
+            const sf::FloatRect tileRect(c * TileSize, r * TileSize, TileSize, TileSize);
+            if (rules & CollisionRules::Solid) {
+                consider(tileRect);
+            } else {
+                // half fire / half water: doar jumatatea de jos e solida
+                const float halfH = TileSize * 0.5f;
+                consider(sf::FloatRect(tileRect.left, tileRect.top + halfH, tileRect.width, halfH));
+            }
+            return true;
+        });
+        platforms.forEachNear(area, [&](std::size_t p) {
+            consider(platforms.bounds(p));
+        });
+        if (area.top + area.height >= worldFloor.top) consider(worldFloor);
+        // ceilalti actori, in pozitia lor de acum (mutati deja sau nu); vecinii din broadphase
+        // ii acopera pe toti cei pe care cutia maturata i-ar putea atinge
+        for (const std::uint32_t j : broadphase.neighbors(id)) {
+            consider(actors.bounds(j));
+        }
+
+        if (!hit) {
+            cb.left += d.x;
+            cb.top += d.y;
+            break;
+        }
+
+        cb.left += d.x * toi;
+        cb.top += d.y * toi;
+        // restul deplasarii continua doar de-a lungul suprafetei lovite
+        d *= 1.f - toi;
+        if (normal.x != 0.f) {
+            d.x = 0.f;
+        } else {
+            d.y = 0.f;
+            if (normal.y < 0.f) landed = true;
+            else hitCeiling = true;
+        }
+    }
+
+    actors.setPosition(id, {cb.left, cb.top});
+    if (landed) actors.setOnGround(id, true);
+    if (hitCeiling) actors.stopVerticalMovement(id);
+}
+
+void Simulation::snapshot(WorldSnapshot& out) const {
+    out.tick = tickCount;
+    out.levelEpoch = levelEpoch;
+    out.tickDt = tickDt;
+
+    out.characters.clear();
+    for (size_t i = 0; i < characters.size(); ++i) {
+        if (!characters[i]) continue;
+        out.characters.push_back({actors.previousPosition(i), actors.position(i), actors.size(i),
+                                  characters[i]->playerType()});
+    }
+    // copiere de vectori de aceeasi marime: fara alocari dupa primele tick-uri; din platforme
+    // doar dreptunghiurile, nu si hash-ul lor
+    const PlatformStore& platforms = map.getPlatforms();
+    out.platforms.resize(platforms.size());
+    for (std::size_t p = 0; p < platforms.size(); ++p) {
+        out.platforms[p] = {platforms.interpolatedBounds(p, 0.f), platforms.bounds(p)};
+    }
+    out.tileEdits = tileEdits;
+    out.tileEditsRevision = tileEditsRevision;
+
+    out.level = currentLevel;
+    out.collectedCoins = collectedCoins;
+    out.totalCoins = totalCoins;
+    out.won = won;
+    out.gameOver = gameOver;
+}
+
+void Simulation::saveState(StateBytes::Buffer& out) const {
+    // antetul verifica la citire ca starea e din acelasi nivel si cu aceiasi actori
+    StateBytes::append(out, levelEpoch);
+    StateBytes::append(out, static_cast<std::uint32_t>(actors.size()));
+    StateBytes::append(out, tickCount);
+    StateBytes::append(out, static_cast<std::uint32_t>(tileEdits.size()));
+    StateBytes::append(out, collectedCoins);
+    StateBytes::append(out, static_cast<std::uint8_t>((won ? 1 : 0) | (gameOver ? 2 : 0)));
+    for (const bool atExit : charactersAtExit) StateBytes::append(out, static_cast<std::uint8_t>(atExit));
+    actors.saveState(out);
+    map.savePlatformState(out);
+}
+
+void Simulation::loadState(const StateBytes::Buffer& state) {
+    const std::uint8_t* in = state.data();
+    std::uint32_t epoch = 0, actorCount = 0, editCount = 0;
+    in = StateBytes::read(in, epoch);
+    in = StateBytes::read(in, actorCount);
+    if (epoch != levelEpoch || actorCount != actors.size()) {
+        throw GameError("Rewind state belongs to another level or actor set");
+    }
+    in = StateBytes::read(in, tickCount);
+    in = StateBytes::read(in, editCount);
+    if (editCount > tileEdits.size()) {
+        throw GameError("Rewind state is newer than the current tile edits");
+    }
+    in = StateBytes::read(in, collectedCoins);
+    std::uint8_t flags = 0;
+    in = StateBytes::read(in, flags);
+    won = (flags & 1) != 0;
+    gameOver = (flags & 2) != 0;
+    for (std::size_t i = 0; i < charactersAtExit.size(); ++i) {
+        std::uint8_t atExit = 0;
+        in = StateBytes::read(in, atExit);
+        charactersAtExit[i] = atExit != 0;
+    }
+    in = actors.loadState(in);
+
+    // monedele luate dupa starea ceruta: harta se reface din sursa si primele editCount schimbari.
+    // restorePristine muta si platformele, deci starea lor se citeste dupa
+    if (editCount < tileEdits.size()) {
+        map.restorePristine();
+        tileEdits.resize(editCount);
+        for (const TileEdit& e : tileEdits) map.setTileTypeAtGrid(e.col, e.row, e.type);
+        ++tileEditsRevision;
+    }
+    map.loadPlatformState(in);
+}
+
+sf::Vector2f Simulation::interpolatedPosition(std::size_t i, float alpha) const {
+    const sf::Vector2f current = actors.position(i);
+    const sf::Vector2f previous = actors.previousPosition(i);
+    return previous + (current - previous) * alpha;
+}
+
+sf::FloatRect Simulation::charactersFocus(float alpha) const {
+    bool any = false;
+    float left = 0.f, top = 0.f, right = 0.f, bottom = 0.f;
+    for (size_t i = 0; i < characters.size(); ++i) {
+        if (!characters[i]) continue;
+        const sf::FloatRect b(interpolatedPosition(i, alpha), actors.size(i));
+        if (!any) {
+            left = b.left; top = b.top; right = b.left + b.width; bottom = b.top + b.height;
+            any = true;
+        } else {
+            left = std::min(left, b.left);
+            top = std::min(top, b.top);
+            right = std::max(right, b.left + b.width);
+            bottom = std::max(bottom, b.top + b.height);
+        }
+    }
+    // fara personaje: centrul hartii
+    if (!any) return map.worldBounds();
+    return sf::FloatRect(left, top, right - left, bottom - top);
+}
+
+std::ostream& operator<<(std::ostream& os, const Simulation& s) {
+    os << "Map: " << s.map.getWidth() << "x" << s.map.getHeight() << "\n";
+    for (size_t i = 0; i < s.characters.size(); ++i) {
+        if (s.characters[i]) os << "Character[" << i << "]: " << *s.characters[i] << "\n";
+    }
+    return os;
+}
@@ -0,0 +1,201 @@
+#ifndef OOP_SIMULATION_H
+#define OOP_SIMULATION_H
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "Map.h"
+#include "Character.h"
+#include "ActorStore.h"
+#include "SweepAndPrune.h"
+#include "WorldSnapshot.h"
+
+// comenzile unui personaj pentru un pas de simulare (tastatura, replay sau script)
+struct CharacterInput {
+    bool left = false;
+    bool right = false;
+    bool jump = false;
+};
+
+// Logica jocului fara fereastra si fara texturi: harta, personaje, fizica, coliziuni,
+// monede si conditiile de castig/pierdere. Game o deseneaza; oop_headless o ruleaza fara display.
+// Avanseaza doar in tick-uri de durata fixa, deci aceleasi input-uri dau exact aceeasi stare
+// indiferent de framerate-ul ferestrei.
+class Simulation {
+public:
+    static constexpr int DefaultTickRate = 60;
+
+private:
+    Map map;
+
+    // starea fizica a tuturor actorilor (SoA): personajele jucatorilor sunt Id-urile
+    // [0, characters.size()), NPC-urile urmeaza dupa ele
+    ActorStore actors;
+    // actorii exact cum erau dupa spawn, pentru restart
+    ActorStore pristineActors;
+    // fatadele polimorfice ale personajelor, legate de actors
+    std::vector<std::unique_ptr<Character>> characters;
+    // starea de de exit
+    std::vector<bool> charactersAtExit;
+    // pozitii de spawn
+    std::vector<sf::Vector2f> spawnPositions;
+
+    int tickRate = DefaultTickRate;
+    float tickDt = 1.f / DefaultTickRate;
+    // tick-uri rulate de la pornirea/restartul nivelului
+    std::uint64_t tickCount = 0;
+    // creste la fiecare startLevel/restart (WorldSnapshot::levelEpoch)
+    std::uint32_t levelEpoch = 0;
+    // tile-urile schimbate de la inceputul nivelului, pentru harta desenata pe alt fir
+    std::vector<TileEdit> tileEdits;
+    // creste cand un rewind scurteaza tileEdits: harta desenata se reface din nou
+    std::uint32_t tileEditsRevision = 0;
+
+    LevelType currentLevel = LevelType::Level1;
+    bool won = false;
+    bool gameOver = false;
+    int totalCoins = 0;
+    int collectedCoins = 0;
+
+    // date de lucru ale unui tick, refacute de prepareMoves()
+    static constexpr ActorStore::Id NoSupport = static_cast<ActorStore::Id>(-1);
+    // perechile de actori care se pot atinge, sweep-and-prune pe X
+    SweepAndPrune broadphase;
+    // deplasarea orizontala primita de la platforma pe care sta fiecare actor
+    std::vector<float> carryX;
+    // actorul pe capul caruia sta fiecare, sau NoSupport
+    std::vector<ActorStore::Id> supporters;
+    // ordinea in care se misca actorii: cei purtati dupa cei care ii poarta
+    std::vector<ActorStore::Id> moveOrder;
+    std::vector<ActorStore::Id> riderScratch;
+    // insulele broadphase-ului: actorii legati prin perechi care se pot atinge. Actorii din insule
+    // diferite nu se vad in moveActor, deci insulele se misca in paralel; in insula, ordinea e cea din moveOrder.
+    // Compact (CSR): islandActors[islandStart[k], islandStart[k + 1]) e insula k
+    std::vector<std::uint32_t> islandStart;
+    std::vector<ActorStore::Id> islandActors;
+    // union-find pe perechi, apoi insula fiecarui actor
+    std::vector<std::uint32_t> islandParent;
+    std::vector<std::uint32_t> islandOf;
+
+    // efectul interactiunii unui actor cu tile-urile, aplicat abia la sfarsitul tick-ului
+    struct InteractionEvent {
+        enum class Kind : std::uint8_t { Coin, Death, Exit };
+        Kind kind;
+        ActorStore::Id actor;
+        // moneda luata: celula si tile-ul vazut de personaj
+        int col = 0;
+        int row = 0;
+        TileType tile = TileType::Empty;
+    };
+    // cate un buffer de evenimente pentru fiecare bucata de actori din parallelFor
+    std::vector<std::vector<InteractionEvent>> interactionBuffers;
+
+    // tile-urile atinse de actor (monede, iesiri, tile-uri letale; la NPC-uri doar cele letale), ca
+    // evenimente in out; doar citeste harta si actorii, deci ruleaza in paralel pentru actori diferiti
+    void collectInteractions(ActorStore::Id id, std::vector<InteractionEvent>& out) const;
+    // aplica evenimentele in ordinea Id-urilor, ca in bucla secventiala: moneda o ia primul
+    // personaj care o atinge, moartea unui personaj termina nivelul (un NPC reapare la spawn),
+    // iesirea conteaza doar daca a supravietuit
+    void applyInteractions();
+    // scoate actorul din platformele care l-au impins; intoarce deplasarea platformei pe care sta.
+    // Modifica doar actorul id, deci ruleaza in paralel pentru actori diferiti
+    float platformCarry(ActorStore::Id id);
+    // inainte de miscare: caratul de pe platforme, broadphase-ul, cine pe cine poarta, ordinea si insulele
+    void prepareMoves();
+    // deplasarea unui tick cu swept AABB fata de tile-urile blocante, platforme si ceilalti actori:
+    // personajul se opreste exact la primul contact si aluneca pe suprafata, fara sub-pasi
+    void moveActor(ActorStore::Id id);
+    void initializeCharacters();
+    // dupa incarcarea hartii: personaje la spawn, contoare si flag-uri resetate
+    void beginLevel();
+    // dupa copiere/swap, fatadele trebuie sa arate spre store-ul acestui obiect
+    void bindCharacters() noexcept;
+
+    void applyInput(const std::vector<CharacterInput>& inputs, float dt);
+    void update(float dt);
+
+public:
+    // ticksPerSecond: pasi de simulare pe secunda (> 0)
+    explicit Simulation(int mapW = 14, int mapH = 9, int ticksPerSecond = DefaultTickRate);
+    // copiere folosind clone() pentru personajele polimorfice
+    Simulation(const Simulation& other);
+    Simulation& operator=(Simulation other);
+
+    void swap(Simulation& other) noexcept {
+        using std::swap;
+        swap(map, other.map);
+        swap(actors, other.actors);
+        swap(pristineActors, other.pristineActors);
+        swap(characters, other.characters);
+        swap(charactersAtExit, other.charactersAtExit);
+        swap(spawnPositions, other.spawnPositions);
+        swap(tickRate, other.tickRate);
+        swap(tickDt, other.tickDt);
+        swap(tickCount, other.tickCount);
+        swap(levelEpoch, other.levelEpoch);
+        swap(tileEdits, other.tileEdits);
+        swap(tileEditsRevision, other.tileEditsRevision);
+        swap(currentLevel, other.currentLevel);
+        swap(won, other.won);
+        swap(gameOver, other.gameOver);
+        swap(totalCoins, other.totalCoins);
+        swap(collectedCoins, other.collectedCoins);
+        bindCharacters();
+        other.bindCharacters();
+    }
+    friend void swap(Simulation& a, Simulation& b) noexcept { a.swap(b); }
+
+    void startLevel(LevelType level);
+    // nivel dintr-un fisier explicit (.txt sau .fbwl)
+    void startLevel(const std::string& path);
+    // restart rapid din snapshot-ul de dupa incarcare
+    void restart();
+
+    // starea de la sfarsitul ultimului tick, la finalul lui out, pentru RewindBuffer: actori, platforme,
+    // cate tile-uri s-au schimbat, contoare si flag-uri. Fara harta: tile-urile se refac din tileEdits
+    void saveState(StateBytes::Buffer& out) const;
+    // revine la o stare scrisa de saveState in acelasi nivel, cu aceiasi actori si cu cel mult
+    // tileEdits-urile de acum; arunca GameError altfel
+    void loadState(const StateBytes::Buffer& state);
+
+    // un tick de durata getTickDt(); inputs[i] comanda actorul i (intai personajele, apoi NPC-urile);
+    // ignorat dupa castig/pierdere
+    void step(const std::vector<CharacterInput>& inputs);
+
+    int getTickRate() const { return tickRate; }
+    float getTickDt() const { return tickDt; }
+    std::uint64_t getTickCount() const { return tickCount; }
+
+    const Map& getMap() const { return map; }
+    const std::vector<std::unique_ptr<Character>>& getCharacters() const { return characters; }
+    const ActorStore& getActors() const { return actors; }
+
+    // actor fara personaj (multimi, nivele de stres): aceeasi fizica si coliziuni cu harta,
+    // dar nu colecteaza monede si nu conteaza la castig/pierdere (pe un tile letal reapare la spawn);
+    // dispare la startLevel
+    ActorStore::Id spawnNpc(Element element, const sf::Vector2f& position,
+                            const sf::Vector2f& hitbox = {static_cast<float>(TileSize), static_cast<float>(TileSize)});
+    LevelType getCurrentLevel() const { return currentLevel; }
+    bool isWon() const { return won; }
+    bool isGameOver() const { return gameOver; }
+    int getTotalCoins() const { return totalCoins; }
+    int getCollectedCoins() const { return collectedCoins; }
+
+    // starea de desenat dupa ultimul tick, in out (vectorii lui se refolosesc); fara tickTime
+    void snapshot(WorldSnapshot& out) const;
+    std::uint32_t getLevelEpoch() const { return levelEpoch; }
+
+    // pozitia actorului i intre ultimele doua tick-uri: alpha 0 = tick-ul anterior, 1 = cel curent
+    sf::Vector2f interpolatedPosition(std::size_t i, float alpha) const;
+    // dreptunghiul care cuprinde toate personajele, tinta camerei
+    sf::FloatRect charactersFocus(float alpha = 1.f) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const Simulation& s);
+};
+
+#endif // OOP_SIMULATION_H
@@ -0,0 +1,103 @@
+#include "SimulationThread.h"
+#include <chrono>
+
+SimulationThread::SimulationThread(Simulation& simulation, Replay* recording)
+    : sim(simulation), timestep(simulation.getTickDt()), timeline(simulation.getCharacters().size()),
+      recorder(recording),
+      history(static_cast<std::size_t>(RewindSeconds * simulation.getTickRate()),
+              static_cast<std::size_t>(simulation.getTickRate()))
+{
+    remember();
+    publish(now());
+    thread = std::thread(&SimulationThread::loop, this);
+}
+
+SimulationThread::~SimulationThread() {
+    stopping.store(true);
+    if (thread.joinable()) thread.join();
+}
+
+double SimulationThread::now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const WorldSnapshot& SimulationThread::latest() {
+    if (failed.load()) std::rethrow_exception(failure);
+    snapshots.update();
+    return snapshots.read();
+}
+
+void SimulationThread::remember() {
+    stateScratch.clear();
+    sim.saveState(stateScratch);
+    history.push(stateScratch);
+}
+
+void SimulationThread::publish(double now) {
+    WorldSnapshot& s = snapshots.writeSlot();
+    sim.snapshot(s);
+    // restul din acumulator a trecut deja din tick-ul urmator
+    s.tickTime = now - static_cast<double>(timestep.alpha()) * sim.getTickDt();
+    s.latestInputTime = timeline.newestAppliedTime();
+    s.rewinding = rewinding.load();
+    snapshots.publish();
+}
+
+void SimulationThread::loop() {
+    try {
+        double last = now();
+        while (!stopping.load()) {
+            if (restartRequested.exchange(false)) {
+                sim.restart();
+                if (recorder) recorder->recordRestart();
+                history.clear();
+                remember();
+                timestep.reset();
+                last = now();
+                publish(last);
+            }
+
+            // coada se goleste la fiecare trecere, nu doar cand urmeaza tick-uri: altfel, cat timp
+            // firul asteapta (sau cand tick-ul intarzie), evenimentele stau in coada si o pot umple
+            InputEvent e;
+            while (inputEvents.pop(e)) timeline.receive(e);
+
+            const double t = now();
+            const int ticks = timestep.advance(t - last);
+            last = t;
+            if (ticks > 0) {
+                // tick-urile recuperate acum s-ar fi terminat, pe ceasul real, la intervale de dt
+                // inainte de ultimul; fiecare primeste doar evenimentele de pana la finalul lui
+                const double dt = sim.getTickDt();
+                const double lastTickEnd = t - static_cast<double>(timestep.alpha()) * dt;
+                const bool backwards = rewinding.load();
+                for (int i = 0; i < ticks; ++i) {
+                    // si la rewind evenimentele se consuma, ca tastele tinute sa fie la zi la revenire
+                    const std::vector<CharacterInput>& in = timeline.inputsUntil(lastTickEnd - (ticks - 1 - i) * dt);
+                    if (backwards) {
+                        if (!history.stepBack(stateScratch)) continue;
+                        sim.loadState(stateScratch);
+                        if (recorder) recorder->rewind();
+                    } else {
+                        // dupa castig/pierdere step nu avanseaza: nici istoria, nici inregistrarea nu
+                        // primesc stari identice (rewind-ul scoate cate un tick din amandoua)
+                        const std::uint64_t before = sim.getTickCount();
+                        sim.step(in);
+                        if (sim.getTickCount() != before) {
+                            if (recorder) recorder->record(in);
+                            remember();
+                        }
+                    }
+                }
+                publish(t);
+            }
+
+            // pana la tick-ul urmator firul nu are nimic de facut
+            const double untilNextTick = (1.0 - timestep.alpha()) * sim.getTickDt();
+            std::this_thread::sleep_for(std::chrono::duration<double>(untilNextTick));
+        }
+    } catch (...) {
+        failure = std::current_exception();
+        failed.store(true);
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef OOP_SIMULATIONTHREAD_H
+#define OOP_SIMULATIONTHREAD_H
+
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "FixedTimestep.h"
+#include "InputTimeline.h"
+#include "Replay.h"
+#include "RewindBuffer.h"
+#include "Simulation.h"
+#include "SpscQueue.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
+
+// Ruleaza Simulation pe un fir separat, cu tick-uri fixe dupa ceasul real, independent de cat
+// dureaza desenarea (vsync, driver). Comunicarea cu firul ferestrei e fara lock-uri: evenimentele de
+// tastatura intra printr-o coada SPSC, cu momentul lor, si fiecare ajunge in tick-ul in care a avut loc;
+// snapshot-ul ultimului tick iese printr-un triple buffer.
+// Cat timp firul ruleaza, Simulation nu se atinge din afara.
+class SimulationThread {
+private:
+    Simulation& sim;
+    FixedTimestep timestep;
+    // firul ferestrei -> firul simularii; plina doar daca simularea sta sute de tick-uri
+    SpscQueue<InputEvent, 1024> inputEvents;
+    // doar pe firul simularii
+    InputTimeline timeline;
+    // optional: primeste comenzile fiecarui tick; se citeste doar dupa oprirea firului
+    Replay* recorder;
+    // starile ultimelor RewindSeconds; cat timp rewinding e setat, fiecare tick merge unul inapoi
+    RewindBuffer history;
+    StateBytes::Buffer stateScratch;
+    std::atomic<bool> rewinding{false};
+    TripleBuffer<WorldSnapshot> snapshots;
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> restartRequested{false};
+    // o exceptie din simulare, aruncata mai departe pe firul ferestrei de latest()
+    std::atomic<bool> failed{false};
+    std::exception_ptr failure;
+    std::thread thread;
+
+    void loop();
+    // starea curenta a simularii intra in history
+    void remember();
+    // snapshot-ul starii curente; now: momentul ultimului advance()
+    void publish(double now);
+
+public:
+    // cat timp se poate merge inapoi; o stare pe tick, cu keyframe o data pe secunda
+    static constexpr int RewindSeconds = 300;
+
+    // publica starea curenta, apoi porneste firul; recording (optional) inregistreaza tick-urile
+    explicit SimulationThread(Simulation& simulation, Replay* recording = nullptr);
+    // opreste firul si asteapta sa se termine tick-ul in curs
+    ~SimulationThread();
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // secunde pe ceasul monoton folosit pentru WorldSnapshot::tickTime
+    static double now();
+
+    // firul ferestrei: un eveniment de tastatura, in ordinea timpului; false daca coada e plina
+    bool pushInput(const InputEvent& e) { return inputEvents.push(e); }
+    // firul ferestrei: cat timp e pornit, simularea merge inapoi cate un tick pe tick, cat are istorie
+    void setRewinding(bool on) { rewinding.store(on); }
+    // firul ferestrei: restart la inceputul urmatorului tick
+    void requestRestart() { restartRequested.store(true); }
+    // firul ferestrei: cel mai nou snapshot, valabil pana la urmatorul apel
+    const WorldSnapshot& latest();
+};
+
+#endif // OOP_SIMULATIONTHREAD_H
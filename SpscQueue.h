@@ -0,0 +1,40 @@
+#ifndef OOP_SPSCQUEUE_H
+#define OOP_SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Coada fara lock-uri pentru un singur producator si un singur consumator (fire diferite),
+// cu capacitate fixa (putere a lui 2). Fara alocari dupa constructie.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    std::array<T, Capacity> items{};
+    // contoare care doar cresc; pozitia in items e contor & (Capacity - 1)
+    alignas(64) std::atomic<std::size_t> head{0}; // urmatorul de citit (consumator)
+    alignas(64) std::atomic<std::size_t> tail{0}; // urmatorul de scris (producator)
+
+public:
+    // producator: false daca coada e plina (elementul nu intra)
+    bool push(const T& value) {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) return false;
+        items[t & (Capacity - 1)] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumator: false daca coada e goala
+    bool pop(T& out) {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        out = items[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+#endif // OOP_SPSCQUEUE_H
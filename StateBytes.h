@@ -0,0 +1,47 @@
+#ifndef OOP_STATEBYTES_H
+#define OOP_STATEBYTES_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Serializare bruta (memcpy, fara versiuni) a starii unui tick, pentru RewindBuffer: starea se citeste
+// inapoi doar in acelasi proces si acelasi nivel, deci layout-ul nu trebuie sa fie portabil.
+namespace StateBytes {
+    using Buffer = std::vector<std::uint8_t>;
+
+    template <typename T>
+    void append(Buffer& out, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const std::size_t at = out.size();
+        out.resize(at + sizeof(T));
+        std::memcpy(out.data() + at, &value, sizeof(T));
+    }
+
+    // doar elementele: cititorul stie deja cate sunt
+    template <typename T>
+    void append(Buffer& out, const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const std::size_t at = out.size();
+        out.resize(at + values.size() * sizeof(T));
+        if (!values.empty()) std::memcpy(out.data() + at, values.data(), values.size() * sizeof(T));
+    }
+
+    template <typename T>
+    const std::uint8_t* read(const std::uint8_t* in, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::memcpy(&value, in, sizeof(T));
+        return in + sizeof(T);
+    }
+
+    // values are deja marimea scrisa de append
+    template <typename T>
+    const std::uint8_t* read(const std::uint8_t* in, std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (!values.empty()) std::memcpy(values.data(), in, values.size() * sizeof(T));
+        return in + values.size() * sizeof(T);
+    }
+}
+
+#endif // OOP_STATEBYTES_H
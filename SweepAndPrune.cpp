@@ -0,0 +1,77 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+#include <numeric>
+
+void SweepAndPrune::resize(std::size_t count) {
+    if (count == minX.size()) return;
+    minX.assign(count, 0.f);
+    maxX.assign(count, 0.f);
+    minY.assign(count, 0.f);
+    maxY.assign(count, 0.f);
+    order.resize(count);
+    std::iota(order.begin(), order.end(), std::uint32_t{0});
+    offsets.assign(count + 1, 0);
+    neighborIds.clear();
+    pairs.clear();
+    // cutiile noi nu au inca ordine: primul update sorteaza o data, nu prin insertie (O(n^2))
+    sorted = false;
+}
+
+void SweepAndPrune::update() {
+    // insertie: O(n) cand ordinea de la tick-ul anterior e aproape corecta.
+    // La egalitate decide Id-ul, ca ordinea (si perechile) sa fie aceleasi pe orice platforma.
+    const auto before = [this](std::uint32_t a, std::uint32_t b) {
+        return minX[a] < minX[b] || (minX[a] == minX[b] && a < b);
+    };
+    if (!sorted) {
+        std::sort(order.begin(), order.end(), before);
+        sorted = true;
+    }
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        const std::uint32_t id = order[i];
+        std::size_t j = i;
+        while (j > 0 && before(id, order[j - 1])) {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = id;
+    }
+
+    // sweep: doar cutiile care incep inainte ca cea curenta sa se termine pe X pot fi vecine
+    pairs.clear();
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const std::uint32_t a = order[i];
+        for (std::size_t j = i + 1; j < order.size() && minX[order[j]] <= maxX[a]; ++j) {
+            const std::uint32_t b = order[j];
+            if (minY[a] <= maxY[b] && minY[b] <= maxY[a]) {
+                pairs.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        }
+    }
+
+    // perechi -> liste de vecini (counting sort dupa Id)
+    std::fill(offsets.begin(), offsets.end(), 0);
+    for (const auto& [a, b] : pairs) {
+        ++offsets[a + 1];
+        ++offsets[b + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    neighborIds.resize(pairs.size() * 2);
+    // cu perechile sortate, fiecare lista iese in ordinea Id-urilor: perechile (y, x) cu y < x
+    // vin inaintea celor (x, z). Sortare radix dupa (a, b): doua treceri counting sort stabile,
+    // intai dupa b, apoi dupa a; O(perechi + cutii), fara std::sort pe fiecare tick
+    pairScratch.resize(pairs.size());
+    const auto countingSort = [this](const auto& from, auto& to, auto key) {
+        cursor.assign(minX.size() + 1, 0);
+        for (const auto& p : from) ++cursor[key(p) + 1];
+        std::partial_sum(cursor.begin(), cursor.end(), cursor.begin());
+        for (const auto& p : from) to[cursor[key(p)]++] = p;
+    };
+    countingSort(pairs, pairScratch, [](const auto& p) { return p.second; });
+    countingSort(pairScratch, pairs, [](const auto& p) { return p.first; });
+    cursor.assign(offsets.begin(), offsets.end() - 1);
+    for (const auto& [a, b] : pairs) {
+        neighborIds[cursor[a]++] = b;
+        neighborIds[cursor[b]++] = a;
+    }
+}
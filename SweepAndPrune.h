@@ -0,0 +1,50 @@
+#ifndef OOP_SWEEPANDPRUNE_H
+#define OOP_SWEEPANDPRUNE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+
+// Broadphase sweep-and-prune pe axa X: perechile de cutii care se suprapun (sau se ating).
+// Ordinea sortata dupa marginea stanga se pastreaza intre apeluri; actorii se misca putin
+// de la un tick la altul, deci sortarea prin insertie e practic o singura trecere liniara.
+class SweepAndPrune {
+private:
+    std::vector<float> minX, maxX, minY, maxY;
+    // Id-urile sortate dupa minX
+    std::vector<std::uint32_t> order;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairScratch;
+    // false dupa resize: ordinea se reface cu o sortare completa, nu prin insertie
+    bool sorted = false;
+    // vecinii fiecarei cutii, compact (CSR): neighborIds[offsets[i], offsets[i + 1])
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> neighborIds;
+    std::vector<std::uint32_t> cursor;
+
+public:
+    // numarul de cutii; la schimbare ordinea se reface de la zero
+    void resize(std::size_t count);
+    std::size_t size() const { return minX.size(); }
+
+    void setBox(std::size_t i, const sf::FloatRect& box) {
+        minX[i] = box.left;
+        maxX[i] = box.left + box.width;
+        minY[i] = box.top;
+        maxY[i] = box.top + box.height;
+    }
+
+    // sorteaza si recalculeaza perechile dupa ce toate cutiile au fost setate
+    void update();
+
+    // cutiile care o ating pe i, in ordinea Id-urilor
+    std::span<const std::uint32_t> neighbors(std::size_t i) const {
+        return {neighborIds.data() + offsets[i], neighborIds.data() + offsets[i + 1]};
+    }
+    std::size_t pairCount() const { return pairs.size(); }
+};
+
+#endif // OOP_SWEEPANDPRUNE_H
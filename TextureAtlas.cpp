@@ -0,0 +1,160 @@
+#include "TextureAtlas.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+namespace {
+    // micsorare prin mediere pe blocuri (box filter), ca sa nu pierdem detalii la factori mari
+    sf::Image downscale(const sf::Image& src, unsigned maxHeight) {
+        const sf::Vector2u size = src.getSize();
+        if (size.y <= maxHeight) return src;
+
+        const unsigned dstH = maxHeight;
+        const unsigned dstW = std::max(1u, static_cast<unsigned>(static_cast<unsigned long long>(size.x) * dstH / size.y));
+        std::vector<sf::Uint8> pixels(static_cast<std::size_t>(dstW) * dstH * 4);
+        const sf::Uint8* in = src.getPixelsPtr();
+
+        for (unsigned y = 0; y < dstH; ++y) {
+            const unsigned y0 = y * size.y / dstH;
+            const unsigned y1 = std::max(y0 + 1, (y + 1) * size.y / dstH);
+            for (unsigned x = 0; x < dstW; ++x) {
+                const unsigned x0 = x * size.x / dstW;
+                const unsigned x1 = std::max(x0 + 1, (x + 1) * size.x / dstW);
+                unsigned long sum[4] = {0, 0, 0, 0};
+                for (unsigned sy = y0; sy < y1; ++sy) {
+                    const sf::Uint8* p = in + (static_cast<std::size_t>(sy) * size.x + x0) * 4;
+                    for (unsigned sx = x0; sx < x1; ++sx, p += 4) {
+                        sum[0] += p[0]; sum[1] += p[1]; sum[2] += p[2]; sum[3] += p[3];
+                    }
+                }
+                const unsigned long count = static_cast<unsigned long>(y1 - y0) * (x1 - x0);
+                sf::Uint8* out = &pixels[(static_cast<std::size_t>(y) * dstW + x) * 4];
+                for (int k = 0; k < 4; ++k) out[k] = static_cast<sf::Uint8>(sum[k] / count);
+            }
+        }
+        sf::Image result;
+        result.create(dstW, dstH, pixels.data());
+        return result;
+    }
+}
+
+void TextureAtlas::build(const std::string& directory) {
+    built = true;
+    regions.clear();
+
+    // lista sortata => acelasi layout la fiecare rulare
+    std::vector<std::string> paths;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".png") {
+            paths.push_back(directory + "/" + entry.path().filename().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    // decodarea si micsorarea PNG-urilor sunt independente: cate un job pe imagine.
+    // Doar textura finala se creeaza pe firul cu contextul OpenGL
+    std::vector<sf::Image> decoded(paths.size());
+    std::vector<std::uint8_t> loaded(paths.size(), 0);
+    JobSystem::shared().parallelFor(paths.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            sf::Image img;
+            if (!img.loadFromFile(paths[i])) continue;
+            decoded[i] = downscale(img, MaxImageHeight);
+            loaded[i] = 1;
+        }
+    });
+
+    std::vector<std::pair<std::string, sf::Image>> images;
+    images.reserve(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        if (!loaded[i]) {
+            std::cerr << "[TextureAtlas Error] Failed to load image: " << paths[i] << "\n";
+            continue;
+        }
+        images.emplace_back(paths[i], std::move(decoded[i]));
+    }
+
+    // impachetare pe rafturi: primul loc e zona alba, apoi imaginile de la stanga la dreapta
+    const unsigned whiteSize = 4;
+    unsigned x = Padding + whiteSize + Padding, y = Padding, shelfH = whiteSize;
+    std::vector<sf::IntRect> placed;
+    placed.reserve(images.size());
+    for (const auto& [path, img] : images) {
+        const sf::Vector2u s = img.getSize();
+        if (x + s.x + Padding > AtlasWidth) {
+            x = Padding;
+            y += shelfH + Padding;
+            shelfH = 0;
+        }
+        placed.emplace_back(static_cast<int>(x), static_cast<int>(y), static_cast<int>(s.x), static_cast<int>(s.y));
+        x += s.x + Padding;
+        shelfH = std::max(shelfH, s.y);
+    }
+    const unsigned atlasH = y + shelfH + Padding;
+
+    sf::Image atlas;
+    atlas.create(AtlasWidth, atlasH, sf::Color::Transparent);
+    for (unsigned wy = 0; wy < whiteSize; ++wy)
+        for (unsigned wx = 0; wx < whiteSize; ++wx)
+            atlas.setPixel(Padding + wx, Padding + wy, sf::Color::White);
+    // esantionam doar interiorul zonei albe, ca filtrarea sa nu atinga vecinii
+    whiteRegion = sf::IntRect(static_cast<int>(Padding) + 1, static_cast<int>(Padding) + 1, 2, 2);
+
+    for (std::size_t i = 0; i < images.size(); ++i) {
+        atlas.copy(images[i].second, static_cast<unsigned>(placed[i].left), static_cast<unsigned>(placed[i].top));
+        regions[images[i].first] = placed[i];
+    }
+
+    if (!texture.loadFromImage(atlas)) {
+        std::cerr << "[TextureAtlas Error] Failed to create atlas texture (" << AtlasWidth << "x" << atlasH << ")\n";
+        regions.clear();
+        return;
+    }
+    texture.setSmooth(true);
+}
+
+const sf::IntRect* TextureAtlas::regionFor(const std::string& assetPath) const {
+    auto it = regions.find(assetPath);
+    return it != regions.end() ? &it->second : nullptr;
+}
+
+const sf::IntRect* TextureAtlas::regionFor(TileType t) const {
+    const char* path = assetPath(t);
+    return path ? regionFor(std::string(path)) : nullptr;
+}
+
+const sf::IntRect* TextureAtlas::regionFor(PlayerType p) const {
+    return regionFor(std::string(assetPath(p)));
+}
+
+const char* TextureAtlas::assetPath(TileType t) {
+    switch (t) {
+        case TileType::Solid: return "assets/solid.png";
+        case TileType::HalfFire: return "assets/half_fire.png";
+        case TileType::HalfWater: return "assets/half_water.png";
+        case TileType::ExitFire: return "assets/exit_fireboy.png";
+        case TileType::ExitWater: return "assets/exit_watergirl.png";
+        case TileType::ExitEarth: return "assets/exit_earthboy.png";
+        case TileType::ExitAir: return "assets/exit_airgirl.png";
+        default: return nullptr;
+    }
+}
+
+const char* TextureAtlas::assetPath(PlayerType p) {
+    switch (p) {
+        case PlayerType::Fireboy: return "assets/fireboy1.png";
+        case PlayerType::Watergirl: return "assets/watergirl1.png";
+        case PlayerType::Earthboy: return "assets/earthboy.png";
+        case PlayerType::Airgirl: return "assets/airgirl.png";
+    }
+    return "";
+}
+
+void TextureAtlas::clear() {
+    texture = sf::Texture();
+    regions.clear();
+}
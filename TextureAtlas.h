@@ -0,0 +1,55 @@
+#ifndef OOP_TEXTUREATLAS_H
+#define OOP_TEXTUREATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include "Tile.h"
+#include "Character.h"
+
+// O singura textura care contine toata arta din assets/*.png (tile-uri, exit-uri, personaje).
+// Imaginile sunt micsorate si impachetate pe rafturi la prima utilizare; fiecare are un
+// dreptunghi UV cautat dupa cale, TileType sau PlayerType. Quad-urile doar colorate
+// folosesc o zona alba din atlas, astfel incat toata scena se deseneaza cu aceeasi textura.
+class TextureAtlas {
+private:
+    sf::Texture texture;
+    std::map<std::string, sf::IntRect> regions;
+    sf::IntRect whiteRegion;
+    bool built = false;
+
+    // inaltimea maxima a unei imagini in atlas (tile-urile au 48px pe ecran)
+    static constexpr unsigned MaxImageHeight = 128;
+    static constexpr unsigned AtlasWidth = 1024;
+    static constexpr unsigned Padding = 2;
+
+    TextureAtlas() = default;
+    void build(const std::string& directory);
+
+public:
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    static TextureAtlas& getInstance() {
+        static TextureAtlas instance;
+        if (!instance.built) instance.build("assets");
+        return instance;
+    }
+
+    const sf::Texture& getTexture() const { return texture; }
+
+    // nullptr daca imaginea lipseste sau nu s-a putut incarca
+    const sf::IntRect* regionFor(const std::string& assetPath) const;
+    const sf::IntRect* regionFor(TileType t) const;
+    const sf::IntRect* regionFor(PlayerType p) const;
+    // cativa pixeli albi, pentru quad-uri colorate prin culoarea vertex-ului
+    const sf::IntRect& solidColorRegion() const { return whiteRegion; }
+
+    static const char* assetPath(TileType t);
+    static const char* assetPath(PlayerType p);
+
+    // eliberam textura inainte de distrugerea contextului OpenGL (vezi main)
+    void clear();
+};
+
+#endif // OOP_TEXTUREATLAS_H
@@ -1,307 +1,121 @@
 
 #include "Tile.h"
-#include <memory>
+#include "TextureAtlas.h"
 
 
-static std::unique_ptr<sf::Texture> g_halfWaterTex;
-static bool g_halfWaterTexTried = false;
-static bool g_halfWaterTexOk = false;
-
-
-static std::unique_ptr<sf::Texture> g_halfFireTex;
-static bool g_halfFireTexTried = false;
-static bool g_halfFireTexOk = false;
-
-
-std::unique_ptr<sf::Texture> Tile::solidTex;
-bool Tile::solidTexLoaded = false;
-bool Tile::solidTexOk = false;
-
-std::unique_ptr<sf::Texture> Tile::exitFireTex;
-std::unique_ptr<sf::Texture> Tile::exitWaterTex;
-std::unique_ptr<sf::Texture> Tile::exitEarthTex;
-std::unique_ptr<sf::Texture> Tile::exitAirTex;
-bool Tile::exitTexturesLoaded = false;
-bool Tile::exitFireLoaded = false;
-bool Tile::exitWaterLoaded = false;
-bool Tile::exitEarthLoaded = false;
-bool Tile::exitAirLoaded = false;
-
-void Tile::cleanupTextures() {
-    solidTex.reset();
-    exitFireTex.reset();
-    exitWaterTex.reset();
-    exitEarthTex.reset();
-    exitAirTex.reset();
-    g_halfWaterTex.reset();
-    g_halfFireTex.reset();
-}
-
-void Tile::ensureExitTexturesLoaded() {
-    if (exitTexturesLoaded) return;
-    // incercam sa incarcam fiecare textura independent; pastam flags
-    // nu flosim throw daca incarcarea esueaza, fallback la dreptunghiuriile initiale in caz contrar
-    exitFireTex = std::make_unique<sf::Texture>();
-    exitFireLoaded = exitFireTex->loadFromFile("assets/exit_fireboy.png");
-    exitWaterTex = std::make_unique<sf::Texture>();
-    exitWaterLoaded = exitWaterTex->loadFromFile("assets/exit_watergirl.png");
-    exitEarthTex = std::make_unique<sf::Texture>();
-    exitEarthLoaded = exitEarthTex->loadFromFile("assets/exit_earthboy.png");
-    exitAirTex = std::make_unique<sf::Texture>();
-    exitAirLoaded = exitAirTex->loadFromFile("assets/exit_airgirl.png");
-    exitTexturesLoaded = true;
-}
-
-void Tile::ensureSolidTextureLoaded() {
-    if (solidTexLoaded) return;
-    solidTexLoaded = true;
-    solidTex = std::make_unique<sf::Texture>();
-    solidTexOk = solidTex->loadFromFile("assets/solid.png");
-}
-
-std::string toString(TileType t) {
-    switch (t) {
-        case TileType::Empty: return "Empty";
-        case TileType::Solid: return "Solid";
-        case TileType::Fire: return "Fire";
-        case TileType::Water: return "Water";
-        case TileType::HalfFire: return "HalfFire";
-        case TileType::HalfWater: return "HalfWater";
-        case TileType::Coin: return "Coin";
-        case TileType::FireCoin: return "FireCoin";
-        case TileType::WaterCoin: return "WaterCoin";
-        case TileType::EarthCoin: return "EarthCoin";
-        case TileType::ExitFire: return "ExitFire";
-        case TileType::ExitWater: return "ExitWater";
-        case TileType::ExitEarth: return "ExitEarth";
-        case TileType::ExitAir: return "ExitAir";
-    }
-    return "Unknown";
-}
-
 Tile::Tile(TileType t, int col, int row)
     : type_(t), col_(col), row_(row)
 {
-    shape_.setSize(sf::Vector2f(static_cast<float>(getSize()), static_cast<float>(getSize())));
-    shape_.setPosition(static_cast<float>(col * getSize()), static_cast<float>(row * getSize()));
+}
 
+sf::Color Tile::fillColorFor(TileType t) {
     // setam culorile in functie de tilee
-    switch (type_) {
+    switch (t) {
         case TileType::Empty:
-            shape_.setFillColor(sf::Color::Transparent);
-            break;
+            return sf::Color::Transparent;
         case TileType::Solid:
-            shape_.setFillColor(sf::Color(100, 100, 100));
-            break;
+            return sf::Color(100, 100, 100);
         case TileType::Fire:
-            shape_.setFillColor(sf::Color::Red);
-            break;
+            return sf::Color::Red;
         case TileType::Water:
-            shape_.setFillColor(sf::Color::Blue);
-            break;
+            return sf::Color::Blue;
         case TileType::HalfFire:
             // culoare orientativa
-            shape_.setFillColor(sf::Color::Red);
-            break;
+            return sf::Color::Red;
         case TileType::HalfWater:
-
-            shape_.setFillColor(sf::Color::Blue);
-            break;
+            return sf::Color::Blue;
         case TileType::Coin:
             // culoare orientativa, randarea reala deseneaza doar mijlocul jumatații superioare
-            shape_.setFillColor(sf::Color(200, 200, 0));
-            break;
+            return sf::Color(200, 200, 0);
         case TileType::FireCoin:
             // orientativ
-            shape_.setFillColor(sf::Color(255, 200, 120));
-            break;
+            return sf::Color(255, 200, 120);
         case TileType::WaterCoin:
-
-            shape_.setFillColor(sf::Color::Cyan);
-            break;
+            return sf::Color::Cyan;
         case TileType::EarthCoin:
-
-            shape_.setFillColor(sf::Color::Green);
-            break;
+            return sf::Color::Green;
         case TileType::ExitFire:
-            shape_.setFillColor(sf::Color(255, 165, 0)); // Orange
-            break;
+            return sf::Color(255, 165, 0); // Orange
         case TileType::ExitWater:
-            shape_.setFillColor(sf::Color::Cyan);
-            break;
+            return sf::Color::Cyan;
         case TileType::ExitEarth:
-            shape_.setFillColor(sf::Color::Green);
-            break;
+            return sf::Color::Green;
         case TileType::ExitAir:
-            shape_.setFillColor(sf::Color::White);
-            break;
+            return sf::Color::White;
     }
+    return sf::Color::Transparent;
 }
 
-void Tile::draw(sf::RenderTarget& target) const {
+std::size_t Tile::quads(std::array<TileQuad, MaxQuads>& out) const {
     // nu se deseneaza nimic pt placile empty
-    if (type_ == TileType::Empty) return;
-
-    // randare textured pt solid tiles cu fallback
-    if (type_ == TileType::Solid) {
-        ensureSolidTextureLoaded();
-        if (solidTexOk) {
-            sf::Sprite s;
-            s.setTexture(*solidTex);
-            s.setPosition(shape_.getPosition());
-            const auto texSize = solidTex->getSize();
-            if (texSize.x > 0 && texSize.y > 0) {
-                const float scaleX = Tile::getSize() / static_cast<float>(texSize.x);
-                const float scaleY = Tile::getSize() / static_cast<float>(texSize.y);
-                s.setScale(scaleX, scaleY);
-            }
-            target.draw(s);
-            return; // desenare textured solid
+    if (type_ == TileType::Empty) return 0;
+
+    const sf::Vector2f pos = worldPosition();
+    const float size = static_cast<float>(getSize());
+    const TextureAtlas& atlas = TextureAtlas::getInstance();
+    const sf::IntRect plain = atlas.solidColorRegion();
+
+    // solid si half tiles: imaginea din atlas intinsa pe tot tile-ul, daca exista
+    if (type_ == TileType::Solid || type_ == TileType::HalfFire || type_ == TileType::HalfWater) {
+        if (const sf::IntRect* region = atlas.regionFor(type_)) {
+            out[0] = TileQuad{sf::FloatRect(pos.x, pos.y, size, size), sf::Color::White, *region};
+            return 1;
         }
-        // daca textura nu se incarca- ia culoarea gri de la inceput
+        // daca textura nu se incarca- ia culoarea de fallback de mai jos
     }
 
-    // tratament special pt Halfwater : render cu textura daca exista
-    if (type_ == TileType::HalfWater) {
-        if (!g_halfWaterTexTried) {
-            g_halfWaterTexTried = true;
-            g_halfWaterTex = std::make_unique<sf::Texture>();
-            g_halfWaterTexOk = g_halfWaterTex->loadFromFile("assets/half_water.png");
-        }
-
-        if (g_halfWaterTexOk) {
-            sf::Sprite s;
-            s.setTexture(*g_halfWaterTex);
-            s.setPosition(shape_.getPosition());
-            const auto texSize = g_halfWaterTex->getSize();
-            if (texSize.x > 0 && texSize.y > 0) {
-                const float scaleX = Tile::getSize() / static_cast<float>(texSize.x);
-                const float scaleY = Tile::getSize() / static_cast<float>(texSize.y);
-                s.setScale(scaleX, scaleY);
-            }
-            target.draw(s);
-            return; // desenare halfwaterr
-        }
-        // daca textura nu se incarca, fallback
-    }
-
-    // tratare speciala pt half fire
-    if (type_ == TileType::HalfFire) {
-        if (!g_halfFireTexTried) {
-            g_halfFireTexTried = true;
-            g_halfFireTex = std::make_unique<sf::Texture>();
-            g_halfFireTexOk = g_halfFireTex->loadFromFile("assets/half_fire.png");
-        }
-
-        if (g_halfFireTexOk) {
-            sf::Sprite s;
-            s.setTexture(*g_halfFireTex);
-            s.setPosition(shape_.getPosition());
-            const auto texSize = g_halfFireTex->getSize();
-            if (texSize.x > 0 && texSize.y > 0) {
-                const float scaleX = Tile::getSize() / static_cast<float>(texSize.x);
-                const float scaleY = Tile::getSize() / static_cast<float>(texSize.y);
-                s.setScale(scaleX, scaleY);
-            }
-            target.draw(s);
-            return; // -textura lui halffire(si halfwater) se deseneaza ca un tile intreg
-        }
-        //daca textura esuaza , fallback la jumate rosu jumate gri
-    }
-
-    // textura pt tile urile exit
+    // textura pt tile urile exit: scalare uniforma dupa inaltime, ca un sprite
     if (type_ == TileType::ExitFire || type_ == TileType::ExitWater || type_ == TileType::ExitEarth || type_ == TileType::ExitAir) {
-        ensureExitTexturesLoaded();
-
-        const sf::Texture* tex = nullptr;
-        bool ok = false;
-        switch (type_) {
-            case TileType::ExitFire:  tex = exitFireTex.get();  ok = exitFireLoaded;  break;
-            case TileType::ExitWater: tex = exitWaterTex.get(); ok = exitWaterLoaded; break;
-            case TileType::ExitEarth: tex = exitEarthTex.get(); ok = exitEarthLoaded; break;
-            case TileType::ExitAir:   tex = exitAirTex.get();   ok = exitAirLoaded;   break;
-            default: break;
+        const sf::IntRect* region = atlas.regionFor(type_);
+        if (region && region->height > 0) {
+            const float factor = size / static_cast<float>(region->height);
+            out[0] = TileQuad{sf::FloatRect(pos.x, pos.y, region->width * factor, size), sf::Color::White, *region};
+            return 1;
         }
-
-        if (ok && tex && tex->getSize().y > 0) {
-            sf::Sprite sprite;
-            sprite.setTexture(*tex);
-            float factor = Tile::getSize() / static_cast<float>(tex->getSize().y);
-            sprite.setScale(factor, factor);
-            sprite.setPosition(shape_.getPosition());
-            target.draw(sprite);
-            return;
-        }
-        // daca textura lipseste, fallback la dreptunghiul gri
+        // daca textura lipseste, fallback la dreptunghiul colorat
     }
 
-    // Pentru Fire/Water și HalfFire/HalfWater, desenăm două jumătăți:
+    // Pentru Fire/Water și HalfFire/HalfWater, două jumătăți:
     //  - jumatatea superioara: culoarea actuală (roșu/albastru)
     //  - jumatatea inferioara: gri (ca la Solid)
     if (type_ == TileType::Fire || type_ == TileType::Water ||
         type_ == TileType::HalfFire || type_ == TileType::HalfWater) {
-        const sf::Vector2f pos = shape_.getPosition();
-        const sf::Vector2f size = shape_.getSize();
-
-        const float halfH = size.y / 2.f;
-
-        sf::RectangleShape top(sf::Vector2f(size.x, halfH));
-        top.setPosition(pos);
-        bool isFireTop = (type_ == TileType::Fire || type_ == TileType::HalfFire);
-        top.setFillColor(isFireTop ? sf::Color::Red : sf::Color::Blue);
-
-        sf::RectangleShape bottom(sf::Vector2f(size.x, halfH));
-        bottom.setPosition(sf::Vector2f(pos.x, pos.y + halfH));
-        bottom.setFillColor(sf::Color(100, 100, 100));
-
-        // Ordinea de desen nu contează mult aici, dar desenăm întâi partea de jos
-        target.draw(bottom);
-        target.draw(top);
-        return;
+        const float halfH = size / 2.f;
+        const bool isFireTop = (type_ == TileType::Fire || type_ == TileType::HalfFire);
+        out[0] = TileQuad{sf::FloatRect(pos.x, pos.y + halfH, size, halfH), sf::Color(100, 100, 100), plain};
+        out[1] = TileQuad{sf::FloatRect(pos.x, pos.y, size, halfH), isFireTop ? sf::Color::Red : sf::Color::Blue, plain};
+        return 2;
     }
 
-    // coin-uri: desenam doar zona de monedă (mijlocul jumatații superioare)
-    if (type_ == TileType::Coin || type_ == TileType::FireCoin || type_ == TileType::WaterCoin || type_ == TileType::EarthCoin) {
-        const sf::Vector2f pos = shape_.getPosition();
-        const sf::Vector2f size = shape_.getSize();
-        const float halfH = size.y / 2.f; // jumatatea superioara
-        const float quarterW = size.x / 4.f;
-        const float coinLeft = pos.x + quarterW;      // exclude 1/4 stânga
-        const float coinWidth = size.x / 2.f;         // mijloc (1/2 lățime)
-        const float coinTop = pos.y;                  // an jumatatea superioara
-        const float coinHeight = halfH;               // toată jumatatea superioara
-
-        sf::RectangleShape coin(sf::Vector2f(coinWidth, coinHeight));
-        coin.setPosition(sf::Vector2f(coinLeft, coinTop));
-        // culoare in functie de tip
+    // coin-uri: doar zona de monedă (mijlocul jumatații superioare), cu o margine de 1px
+    if (isCoin(type_)) {
+        const sf::FloatRect coin(pos.x + size / 4.f, pos.y, size / 2.f, size / 2.f);
+        sf::Color fill;
+        sf::Color outline;
         if (type_ == TileType::FireCoin) {
             // portocaliu deschis pt fireboy
-            coin.setFillColor(sf::Color(255, 200, 120));
+            fill = sf::Color(255, 200, 120);
+            outline = sf::Color(200, 120, 60);
         } else if (type_ == TileType::WaterCoin) {
-            coin.setFillColor(sf::Color::Cyan);
+            fill = sf::Color::Cyan;
+            outline = sf::Color(0, 120, 160);
         } else if (type_ == TileType::EarthCoin) {
-            coin.setFillColor(sf::Color::Green);
+            fill = sf::Color::Green;
+            outline = sf::Color(0, 100, 0);
         } else {
             // coin generic (compatibilitate): auriu
-            coin.setFillColor(sf::Color(255, 215, 0));
-        }
-        // o margine ușoară- pt dimensiune
-        coin.setOutlineThickness(1.f);
-        if (type_ == TileType::WaterCoin) {
-            coin.setOutlineColor(sf::Color(0, 120, 160));
-        } else if (type_ == TileType::FireCoin) {
-            coin.setOutlineColor(sf::Color(200, 120, 60));
-        } else if (type_ == TileType::EarthCoin) {
-            coin.setOutlineColor(sf::Color(0, 100, 0));
-        } else {
-            coin.setOutlineColor(sf::Color(160, 120, 0));
+            fill = sf::Color(255, 215, 0);
+            outline = sf::Color(160, 120, 0);
         }
-        target.draw(coin);
-        return;
+        // marginea e un dreptunghi mai mare desenat in spatele monedei
+        out[0] = TileQuad{sf::FloatRect(coin.left - 1.f, coin.top - 1.f, coin.width + 2.f, coin.height + 2.f), outline, plain};
+        out[1] = TileQuad{coin, fill, plain};
+        return 2;
     }
 
-    // ptr celelalte tipuri desenam forma standard
-    target.draw(shape_);
+    // ptr celelalte tipuri, forma standard
+    out[0] = TileQuad{sf::FloatRect(pos.x, pos.y, size, size), fillColorFor(type_), plain};
+    return 1;
 }
 
 std::ostream& operator<<(std::ostream& os, const Tile& t) {
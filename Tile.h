@@ -2,15 +2,21 @@
 #define OOP_TILE_H
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string>
-#include <memory>
+#include "TileType.h"
 
-enum class TileType { Empty, Solid, Fire, Water, HalfFire, HalfWater, Coin, FireCoin, WaterCoin, EarthCoin, ExitFire, ExitWater, ExitEarth, ExitAir };
-
-
-std::string toString(TileType t);
+// Un dreptunghi din aspectul unui tile: pozitie in lume, culoare si zona din atlas
+struct TileQuad {
+    sf::FloatRect rect;
+    sf::Color color;
+    sf::IntRect texRect;
+};
 
+// Valoare usoara (tip + pozitie in grila); geometria de randare se calculeaza la cerere
 class Tile {
 public:
     Tile() = default;
@@ -18,40 +24,22 @@ public:
 
     TileType getType() const { return type_; }
 
-//change
-    void draw(sf::RenderTarget& target) const;
-    static constexpr int getSize() { return 48; }
+    static constexpr std::size_t MaxQuads = 2;
+    // completeaza dreptunghiurile care descriu tile-ul (de jos in sus); intoarce cate sunt
+    std::size_t quads(std::array<TileQuad, MaxQuads>& out) const;
+    static constexpr int getSize() { return TileSize; }
 
     friend std::ostream& operator<<(std::ostream& os, const Tile& t);
 
-private:
-    // texturi statice ptr tile ul solid
-    static std::unique_ptr<sf::Texture> solidTex;
-    static bool solidTexLoaded;
-    static bool solidTexOk;      // -daca incarcarea e cu succes
-
-    // texturi statice ptr tile urile exit
-    static std::unique_ptr<sf::Texture> exitFireTex;
-    static std::unique_ptr<sf::Texture> exitWaterTex;
-    static std::unique_ptr<sf::Texture> exitEarthTex;
-    static std::unique_ptr<sf::Texture> exitAirTex;
-    static bool exitTexturesLoaded;
-    static bool exitFireLoaded;          // flag uri individuale pt incarcare cu succes
-    static bool exitWaterLoaded;
-    static bool exitEarthLoaded;
-    static bool exitAirLoaded;
-
-    static void ensureExitTexturesLoaded();
-    static void ensureSolidTextureLoaded();
-
-public:
-    static void cleanupTextures();
-
 private:
     TileType type_ = TileType::Empty;
-    [[maybe_unused]] int col_ = 0;
-    [[maybe_unused]] int row_ = 0;
-    sf::RectangleShape shape_;
+    int col_ = 0;
+    int row_ = 0;
+
+    sf::Vector2f worldPosition() const {
+        return {static_cast<float>(col_ * getSize()), static_cast<float>(row_ * getSize())};
+    }
+    static sf::Color fillColorFor(TileType t);
 };
 
 #endif // OOP_TILE_H
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "TileLayer.h"
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+    std::uint32_t chunkKey(const TileStorage& tiles, int cx, int cy) {
+        return static_cast<std::uint32_t>(cy * tiles.getChunksX() + cx);
+    }
+}
+
+// cache-ul nu se copiaza: copia isi reconstruieste geometria la primul draw
+TileLayer::TileLayer(const TileLayer& other)
+    : maxResidentChunks(other.maxResidentChunks)
+{
+}
+
+TileLayer& TileLayer::operator=(const TileLayer& other) {
+    if (this == &other) return *this;
+    reset();
+    maxResidentChunks = other.maxResidentChunks;
+    return *this;
+}
+
+void TileLayer::appendQuad(sf::VertexArray& vertices, const TileQuad& q) {
+    const float l = q.rect.left, t = q.rect.top;
+    const float r = q.rect.left + q.rect.width, b = q.rect.top + q.rect.height;
+
+    const float tl = static_cast<float>(q.texRect.left), tt = static_cast<float>(q.texRect.top);
+    const float tr = tl + static_cast<float>(q.texRect.width), tb = tt + static_cast<float>(q.texRect.height);
+
+    vertices.append(sf::Vertex({l, t}, q.color, {tl, tt}));
+    vertices.append(sf::Vertex({r, t}, q.color, {tr, tt}));
+    vertices.append(sf::Vertex({r, b}, q.color, {tr, tb}));
+    vertices.append(sf::Vertex({l, t}, q.color, {tl, tt}));
+    vertices.append(sf::Vertex({r, b}, q.color, {tr, tb}));
+    vertices.append(sf::Vertex({l, b}, q.color, {tl, tb}));
+}
+
+void TileLayer::buildMesh(ChunkMesh& mesh, const TileStorage& tiles, int cx, int cy) {
+    mesh.vertices.clear();
+    mesh.revision = tiles.chunkRevision(cx, cy);
+
+    const int baseCol = cx * TileStorage::ChunkSize;
+    const int baseRow = cy * TileStorage::ChunkSize;
+    const int endCol = std::min(baseCol + TileStorage::ChunkSize, tiles.getWidth());
+    const int endRow = std::min(baseRow + TileStorage::ChunkSize, tiles.getHeight());
+    std::array<TileQuad, Tile::MaxQuads> qs;
+    for (int r = baseRow; r < endRow; ++r) {
+        for (int c = baseCol; c < endCol; ++c) {
+            const std::size_t n = Tile(tiles.get(c, r), c, r).quads(qs);
+            for (std::size_t i = 0; i < n; ++i) appendQuad(mesh.vertices, qs[i]);
+        }
+    }
+}
+
+void TileLayer::reset() {
+    resident.clear();
+    lru.clear();
+    contentId = 0;
+}
+
+const TileLayer::ChunkMesh& TileLayer::acquire(const TileStorage& tiles, int cx, int cy) {
+    const std::uint32_t key = chunkKey(tiles, cx, cy);
+    auto it = resident.find(key);
+    if (it != resident.end()) {
+        lru.splice(lru.begin(), lru, it->second.lruPos);
+        // chunk modificat de la ultima construire (ex: moneda colectata)
+        if (it->second.revision != tiles.chunkRevision(cx, cy)) buildMesh(it->second, tiles, cx, cy);
+        return it->second;
+    }
+
+    ChunkMesh& mesh = resident[key];
+    lru.push_front(key);
+    mesh.lruPos = lru.begin();
+    buildMesh(mesh, tiles, cx, cy);
+    return mesh;
+}
+
+void TileLayer::evict(std::size_t visibleCount) {
+    // chunk-urile vizibile sunt in fata listei; eliberam din coada doar pe cele din afara ecranului
+    const std::size_t cap = std::max(maxResidentChunks, visibleCount);
+    while (resident.size() > cap) {
+        resident.erase(lru.back());
+        lru.pop_back();
+    }
+}
+
+void TileLayer::draw(sf::RenderTarget& target, const TileStorage& tiles, const sf::FloatRect& visibleArea) {
+    // alt nivel incarcat: geometria veche nu mai corespunde
+    if (tiles.getContentId() != contentId) {
+        reset();
+        contentId = tiles.getContentId();
+    }
+    if (tiles.getChunksX() == 0 || tiles.getChunksY() == 0) return;
+
+    const float chunkPx = static_cast<float>(TileStorage::ChunkSize * Tile::getSize());
+    const int cx0 = std::max(0, static_cast<int>(std::floor(visibleArea.left / chunkPx)));
+    const int cy0 = std::max(0, static_cast<int>(std::floor(visibleArea.top / chunkPx)));
+    const int cx1 = std::min(tiles.getChunksX() - 1, static_cast<int>(std::floor((visibleArea.left + visibleArea.width) / chunkPx)));
+    const int cy1 = std::min(tiles.getChunksY() - 1, static_cast<int>(std::floor((visibleArea.top + visibleArea.height) / chunkPx)));
+    if (cx0 > cx1 || cy0 > cy1) return;
+
+    const sf::RenderStates states(&TextureAtlas::getInstance().getTexture());
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            const ChunkMesh& mesh = acquire(tiles, cx, cy);
+            if (mesh.vertices.getVertexCount() > 0) target.draw(mesh.vertices, states);
+        }
+    }
+    evict(static_cast<std::size_t>(cx1 - cx0 + 1) * static_cast<std::size_t>(cy1 - cy0 + 1));
+}
@@ -0,0 +1,49 @@
+#ifndef OOP_TILELAYER_H
+#define OOP_TILELAYER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include "Tile.h"
+#include "TileStorage.h"
+
+// Stratul static de tile-uri, randat pe chunk-uri de 32x32 peste textura atlas.
+// Geometria unui chunk se construieste doar cand chunk-ul intra in view si se pastreaza
+// intr-un cache LRU limitat; chunk-urile iesite din ecran sunt eliberate cand cache-ul e plin.
+// Un chunk modificat in simulare (revizia din TileStorage difera) se reconstruieste la urmatorul draw.
+class TileLayer {
+private:
+    struct ChunkMesh {
+        sf::VertexArray vertices{sf::Triangles};
+        std::uint32_t revision = 0;
+        std::list<std::uint32_t>::iterator lruPos;
+    };
+
+    std::unordered_map<std::uint32_t, ChunkMesh> resident;
+    // cel mai recent folosit in fata
+    std::list<std::uint32_t> lru;
+    std::size_t maxResidentChunks = 64;
+    // harta pentru care e construit cache-ul
+    std::uint64_t contentId = 0;
+
+    static void appendQuad(sf::VertexArray& vertices, const TileQuad& q);
+    static void buildMesh(ChunkMesh& mesh, const TileStorage& tiles, int cx, int cy);
+    const ChunkMesh& acquire(const TileStorage& tiles, int cx, int cy);
+    void evict(std::size_t visibleCount);
+
+public:
+    TileLayer() = default;
+    TileLayer(const TileLayer& other);
+    TileLayer& operator=(const TileLayer& other);
+
+    void reset();
+    void setMaxResidentChunks(std::size_t n) { maxResidentChunks = n; }
+    std::size_t residentChunkCount() const { return resident.size(); }
+
+    // deseneaza chunk-urile care intersecteaza visibleArea (coordonate lume)
+    void draw(sf::RenderTarget& target, const TileStorage& tiles, const sf::FloatRect& visibleArea);
+};
+
+#endif // OOP_TILELAYER_H
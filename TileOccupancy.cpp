@@ -0,0 +1,72 @@
+#include "TileOccupancy.h"
+
+TileOccupancy::TileOccupancy(const TileOccupancy& other) {
+    reset(other.width, other.height, other.counts);
+}
+
+TileOccupancy& TileOccupancy::operator=(const TileOccupancy& other) {
+    if (this != &other) reset(other.width, other.height, other.counts);
+    return *this;
+}
+
+TileOccupancy::~TileOccupancy() {
+    releaseChunks();
+}
+
+void TileOccupancy::releaseChunks() {
+    if (!chunks) return;
+    const std::size_t n = static_cast<std::size_t>(chunksX) * static_cast<std::size_t>(chunksY);
+    for (std::size_t i = 0; i < n; ++i) {
+        delete chunks[i].load(std::memory_order_relaxed);
+    }
+    chunks.reset();
+}
+
+void TileOccupancy::reset(int w, int h, const Counts& typeCounts) {
+    releaseChunks();
+    width = w;
+    height = h;
+    chunksX = (w + ChunkSize - 1) >> ChunkShift;
+    chunksY = (h + ChunkSize - 1) >> ChunkShift;
+    counts = typeCounts;
+    const std::size_t n = static_cast<std::size_t>(chunksX) * static_cast<std::size_t>(chunksY);
+    chunks = std::make_unique<std::atomic<ChunkBits*>[]>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+const TileOccupancy::ChunkBits& TileOccupancy::buildChunk(const TileStorage& tiles, std::size_t index) const {
+    auto built = std::make_unique<ChunkBits>();
+    const int baseCol = static_cast<int>(index % static_cast<std::size_t>(chunksX)) * ChunkSize;
+    const int baseRow = static_cast<int>(index / static_cast<std::size_t>(chunksX)) * ChunkSize;
+    for (int r = 0; r < ChunkSize && baseRow + r < height; ++r) {
+        for (int c = 0; c < ChunkSize && baseCol + c < width; ++c) {
+            // valorile au fost verificate la incarcare (LevelLoader / BinaryLevel::map)
+            const TileType t = tiles.get(baseCol + c, baseRow + r);
+            if (t == TileType::Empty) continue;
+            built->rows[static_cast<std::size_t>(t)][static_cast<std::size_t>(r)] |= std::uint32_t{1} << c;
+        }
+    }
+
+    ChunkBits* expected = nullptr;
+    if (chunks[index].compare_exchange_strong(expected, built.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return *built.release();
+    }
+    // alt thread a construit acelasi chunk intre timp; bitii sunt identici
+    return *expected;
+}
+
+void TileOccupancy::change(int col, int row, TileType from, TileType to) {
+    --counts[static_cast<std::size_t>(from)];
+    ++counts[static_cast<std::size_t>(to)];
+    const std::size_t index = static_cast<std::size_t>(row >> ChunkShift) * static_cast<std::size_t>(chunksX)
+                              + static_cast<std::size_t>(col >> ChunkShift);
+    // un chunk neconstruit isi va citi tile-urile deja modificate
+    ChunkBits* bits = chunks[index].load(std::memory_order_acquire);
+    if (!bits) return;
+    const std::size_t localRow = static_cast<std::size_t>(row & (ChunkSize - 1));
+    const std::uint32_t bit = std::uint32_t{1} << (col & (ChunkSize - 1));
+    if (from != TileType::Empty) bits->rows[static_cast<std::size_t>(from)][localRow] &= ~bit;
+    if (to != TileType::Empty) bits->rows[static_cast<std::size_t>(to)][localRow] |= bit;
+}
@@ -0,0 +1,120 @@
+#ifndef OOP_TILEOCCUPANCY_H
+#define OOP_TILEOCCUPANCY_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "TileType.h"
+#include "TileStorage.h"
+
+// Bitset-uri per TileType peste harta, pe aceleasi chunk-uri de 32x32 ca TileStorage
+// (un uint32 per rand de chunk, bitul c = coloana locala c). Intrebari de tipul "ce tile-uri
+// solide pentru Fire sunt in dreptunghiul asta" devin OR pe cateva cuvinte si iterare doar pe bitii setati.
+// Bitii unui chunk se construiesc din tile-uri la prima interogare care il atinge, deci incarcarea
+// unui nivel nu parcurge harta: numaratorile per tip vin gata facute (LevelLoader / header-ul .fbwl).
+// Empty nu are biti.
+class TileOccupancy {
+public:
+    using Counts = std::array<std::size_t, TileTypeCount>;
+
+private:
+    static constexpr int ChunkShift = TileStorage::ChunkShift;
+    static constexpr int ChunkSize = TileStorage::ChunkSize;
+    static_assert(ChunkSize == 32, "one uint32 per chunk row");
+
+    struct ChunkBits {
+        std::array<std::array<std::uint32_t, ChunkSize>, TileTypeCount> rows{};
+    };
+
+    int width = 0;
+    int height = 0;
+    int chunksX = 0;
+    int chunksY = 0;
+    // numarul de celule din fiecare tip, tinut la zi si pentru chunk-urile inca neconstruite
+    Counts counts{};
+    // interogarile sunt const si vin si din parallelFor-ul simularii: un chunk construit se publica
+    // atomic (compare_exchange), iar cine pierde cursa isi sterge copia
+    mutable std::unique_ptr<std::atomic<ChunkBits*>[]> chunks;
+
+    void releaseChunks();
+    const ChunkBits& buildChunk(const TileStorage& tiles, std::size_t index) const;
+    const ChunkBits& chunkAt(const TileStorage& tiles, int chunkX, int chunkY) const {
+        const std::size_t index = static_cast<std::size_t>(chunkY) * static_cast<std::size_t>(chunksX) + static_cast<std::size_t>(chunkX);
+        if (const ChunkBits* bits = chunks[index].load(std::memory_order_acquire)) return *bits;
+        return buildChunk(tiles, index);
+    }
+    // bitii coloanelor locale [lo, hi] dintr-un rand de chunk
+    static std::uint32_t columnMask(int lo, int hi) {
+        const std::uint32_t upper = (hi == ChunkSize - 1) ? ~std::uint32_t{0} : ((std::uint32_t{1} << (hi + 1)) - 1);
+        return upper & ~((std::uint32_t{1} << lo) - 1);
+    }
+    static std::uint32_t rowOf(const ChunkBits& bits, TileMask types, int localRow) {
+        std::uint32_t row = 0;
+        while (types) {
+            const int t = std::countr_zero(types);
+            types &= static_cast<TileMask>(types - 1);
+            row |= bits.rows[static_cast<std::size_t>(t)][static_cast<std::size_t>(localRow)];
+        }
+        return row;
+    }
+
+public:
+    TileOccupancy() = default;
+    // e doar un cache peste tile-uri: copia pastreaza numaratorile si isi reconstruieste bitii la cerere
+    TileOccupancy(const TileOccupancy& other);
+    TileOccupancy& operator=(const TileOccupancy& other);
+    ~TileOccupancy();
+
+    // harta noua de w x h cu numaratorile date; niciun chunk construit
+    void reset(int w, int h, const Counts& typeCounts);
+    // mentine numaratorile (si bitii chunk-ului, daca e construit) dupa o modificare de tile
+    void change(int col, int row, TileType from, TileType to);
+
+    // cate celule din harta au unul din tipurile din types; O(numar de tipuri)
+    std::size_t count(TileMask types) const {
+        std::size_t n = 0;
+        while (types) {
+            n += counts[static_cast<std::size_t>(std::countr_zero(types))];
+            types &= static_cast<TileMask>(types - 1);
+        }
+        return n;
+    }
+
+    // dreptunghi inclusiv, in coordonate de grila deja limitate la harta; tiles e harta peste care s-a facut reset
+    bool any(const TileStorage& tiles, TileMask types, int col0, int row0, int col1, int row1) const {
+        bool found = false;
+        forEach(tiles, types, col0, row0, col1, row1, [&](int, int) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    // apeleaza fn(col, row) pentru fiecare celula din dreptunghi cu unul din tipurile din types,
+    // in ordine row-major; fn intoarce false pentru a opri parcurgerea
+    template <typename Fn>
+    void forEach(const TileStorage& tiles, TileMask types, int col0, int row0, int col1, int row1, Fn&& fn) const {
+        types &= static_cast<TileMask>(~tileBit(TileType::Empty));
+        if (types == 0) return;
+        for (int r = row0; r <= row1; ++r) {
+            const int chunkY = r >> ChunkShift;
+            const int localRow = r & (ChunkSize - 1);
+            for (int chunkX = col0 >> ChunkShift; chunkX <= col1 >> ChunkShift; ++chunkX) {
+                const int base = chunkX << ChunkShift;
+                const int lo = col0 > base ? col0 - base : 0;
+                const int hi = col1 < base + ChunkSize - 1 ? col1 - base : ChunkSize - 1;
+                std::uint32_t bits = rowOf(chunkAt(tiles, chunkX, chunkY), types, localRow) & columnMask(lo, hi);
+                while (bits) {
+                    const int c = base + std::countr_zero(bits);
+                    bits &= bits - 1;
+                    if (!fn(c, r)) return;
+                }
+            }
+        }
+    }
+};
+
+#endif // OOP_TILEOCCUPANCY_H
@@ -0,0 +1,94 @@
+#include "TileStorage.h"
+#include <atomic>
+#include <utility>
+
+std::uint64_t TileStorage::nextContentId() {
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+TileStorage::TileStorage(const TileStorage& other)
+    : width(other.width),
+      height(other.height),
+      chunksX(other.chunksX),
+      chunksY(other.chunksY),
+      fill(other.fill),
+      sourceOwner(other.sourceOwner),
+      source(other.source),
+      dirtyMask(other.dirtyMask),
+      chunkRevisions(other.chunkRevisions),
+      contentId(nextContentId())
+{
+    // sursa e imuabila si se partajeaza; doar chunk-urile modificate se copiaza
+    dirtyChunks.reserve(other.dirtyChunks.size());
+    for (const auto& [key, chunk] : other.dirtyChunks) {
+        dirtyChunks.emplace(key, std::make_unique<Chunk>(*chunk));
+    }
+}
+
+TileStorage& TileStorage::operator=(const TileStorage& other) {
+    if (this == &other) return *this;
+    TileStorage copy(other);
+    *this = std::move(copy);
+    return *this;
+}
+
+void TileStorage::resetGeometry(int w, int h) {
+    width = w;
+    height = h;
+    chunksX = (w + ChunkSize - 1) / ChunkSize;
+    chunksY = (h + ChunkSize - 1) / ChunkSize;
+    const std::size_t chunkCount = static_cast<std::size_t>(chunksX) * static_cast<std::size_t>(chunksY);
+    dirtyMask.assign((chunkCount + 63) / 64, 0);
+    dirtyChunks.clear();
+    chunkRevisions.assign(chunkCount, 0);
+    contentId = nextContentId();
+}
+
+void TileStorage::reset(int w, int h, TileType fillType) {
+    resetGeometry(w, h);
+    fill = fillType;
+    sourceOwner.reset();
+    source = nullptr;
+}
+
+void TileStorage::reset(int w, int h, std::vector<TileType>&& flat) {
+    resetGeometry(w, h);
+    fill = TileType::Empty;
+    auto owner = std::make_shared<const std::vector<TileType>>(std::move(flat));
+    source = owner->data();
+    sourceOwner = std::move(owner);
+}
+
+void TileStorage::reset(int w, int h, MappedFile&& file, const TileType* mappedTiles) {
+    resetGeometry(w, h);
+    fill = TileType::Empty;
+    // pointerul ramane valid: maparea nu se muta in memorie cand obiectul MappedFile se muta
+    sourceOwner = std::make_shared<const MappedFile>(std::move(file));
+    source = mappedTiles;
+}
+
+void TileStorage::set(int col, int row, TileType t) {
+    const std::uint32_t key = chunkIndex(col, row);
+    if (!isDirty(key)) {
+        // prima scriere in chunk: copiem continutul din sursa
+        auto chunk = std::make_unique<Chunk>();
+        const int baseCol = (col >> ChunkShift) << ChunkShift;
+        const int baseRow = (row >> ChunkShift) << ChunkShift;
+        for (int r = 0; r < ChunkSize; ++r) {
+            for (int c = 0; c < ChunkSize; ++c) {
+                const int gc = baseCol + c, gr = baseRow + r;
+                chunk->tiles[static_cast<std::size_t>(r * ChunkSize + c)] =
+                    (gc < width && gr < height) ? sourceAt(gc, gr) : fill;
+            }
+        }
+        dirtyChunks.emplace(key, std::move(chunk));
+        dirtyMask[key >> 6] |= std::uint64_t{1} << (key & 63);
+    }
+    dirtyChunks.find(key)->second->tiles[localIndex(col, row)] = t;
+    ++chunkRevisions[key];
+}
+
+std::size_t TileStorage::residentBytes() const {
+    return dirtyChunks.size() * sizeof(Chunk) + dirtyMask.size() * sizeof(std::uint64_t);
+}
@@ -0,0 +1,119 @@
+#ifndef OOP_TILESTORAGE_H
+#define OOP_TILESTORAGE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "TileType.h"
+#include "MappedFile.h"
+
+// Tile-urile din Map, impartite in chunk-uri de 32x32.
+// Sursa nivelului (fisier .fbwl mapat, vectorul parsat din .txt sau o valoare de umplere)
+// este imuabila si partajata intre copii; chunk-urile modificate in joc (ex: monede colectate)
+// se materializeaza la prima scriere (copy-on-write) si doar ele ocupa memorie in plus.
+// Citirea nu incarca nimic: un chunk nemodificat se citeste direct din sursa.
+class TileStorage {
+public:
+    static constexpr int ChunkShift = 5;
+    static constexpr int ChunkSize = 1 << ChunkShift;
+    static constexpr std::size_t ChunkArea = static_cast<std::size_t>(ChunkSize) * ChunkSize;
+
+private:
+    struct Chunk {
+        std::array<TileType, ChunkArea> tiles;
+    };
+
+    int width = 0;
+    int height = 0;
+    int chunksX = 0;
+    int chunksY = 0;
+    TileType fill = TileType::Empty;
+
+    // proprietarul sursei (vector sau MappedFile), partajat intre copii; source indica in el
+    std::shared_ptr<const void> sourceOwner;
+    const TileType* source = nullptr;
+
+    // un bit per chunk: are copie modificata? evita cautarea in hash pentru chunk-urile curate
+    std::vector<std::uint64_t> dirtyMask;
+    std::unordered_map<std::uint32_t, std::unique_ptr<Chunk>> dirtyChunks;
+    // creste la fiecare scriere in chunk; randarea isi reface geometria cand difera
+    std::vector<std::uint32_t> chunkRevisions;
+    // identitatea continutului: alta la fiecare reset/copie, ca un cache extern sa stie ca e alta harta
+    std::uint64_t contentId = 0;
+    static std::uint64_t nextContentId();
+
+    void resetGeometry(int w, int h);
+    std::uint32_t chunkIndex(int col, int row) const {
+        return static_cast<std::uint32_t>((row >> ChunkShift) * chunksX + (col >> ChunkShift));
+    }
+    static std::size_t localIndex(int col, int row) {
+        return static_cast<std::size_t>((row & (ChunkSize - 1)) * ChunkSize + (col & (ChunkSize - 1)));
+    }
+    bool isDirty(std::uint32_t chunk) const {
+        return (dirtyMask[chunk >> 6] >> (chunk & 63)) & 1u;
+    }
+    TileType sourceAt(int col, int row) const {
+        return source ? source[static_cast<std::size_t>(row) * width + col] : fill;
+    }
+
+public:
+    TileStorage() = default;
+    TileStorage(const TileStorage& other);
+    TileStorage& operator=(const TileStorage& other);
+    TileStorage(TileStorage&&) noexcept = default;
+    TileStorage& operator=(TileStorage&&) noexcept = default;
+    ~TileStorage() = default;
+
+    // harta uniforma, fara nicio alocare pentru tile-uri
+    void reset(int w, int h, TileType fillType);
+    // vector row-major parsat (preluat, nu copiat)
+    void reset(int w, int h, std::vector<TileType>&& flat);
+    // fereastra row-major in interiorul fisierului mapat
+    void reset(int w, int h, MappedFile&& file, const TileType* mappedTiles);
+
+    // (col,row) trebuie sa fie in interiorul hartii; verificarea o face Map
+    TileType get(int col, int row) const {
+        const std::uint32_t chunk = chunkIndex(col, row);
+        if (isDirty(chunk)) return dirtyChunks.find(chunk)->second->tiles[localIndex(col, row)];
+        return sourceAt(col, row);
+    }
+    void set(int col, int row, TileType t);
+
+    // renunta la toate modificarile: harta redevine sursa nivelului (snapshot-ul de dupa incarcare).
+    // onRestore(col, row, current, original) e apelat pentru fiecare celula care se schimba,
+    // ca Map sa-si sincronizeze straturile; costul e proportional cu chunk-urile modificate.
+    template <typename Fn>
+    void revertChanges(Fn&& onRestore) {
+        for (const auto& [key, chunk] : dirtyChunks) {
+            const int baseCol = static_cast<int>(key % static_cast<std::uint32_t>(chunksX)) * ChunkSize;
+            const int baseRow = static_cast<int>(key / static_cast<std::uint32_t>(chunksX)) * ChunkSize;
+            for (int r = 0; r < ChunkSize && baseRow + r < height; ++r) {
+                for (int c = 0; c < ChunkSize && baseCol + c < width; ++c) {
+                    const TileType current = chunk->tiles[static_cast<std::size_t>(r * ChunkSize + c)];
+                    const TileType original = sourceAt(baseCol + c, baseRow + r);
+                    if (current != original) onRestore(baseCol + c, baseRow + r, current, original);
+                }
+            }
+            dirtyMask[key >> 6] &= ~(std::uint64_t{1} << (key & 63));
+            ++chunkRevisions[key];
+        }
+        dirtyChunks.clear();
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getChunksX() const { return chunksX; }
+    int getChunksY() const { return chunksY; }
+    std::size_t dirtyChunkCount() const { return dirtyChunks.size(); }
+    std::uint64_t getContentId() const { return contentId; }
+    std::uint32_t chunkRevision(int chunkX, int chunkY) const {
+        return chunkRevisions[static_cast<std::size_t>(chunkY * chunksX + chunkX)];
+    }
+    // memoria proprie (chunk-uri modificate + masca); sursa mapata e paginata de sistemul de operare
+    std::size_t residentBytes() const;
+};
+
+#endif // OOP_TILESTORAGE_H
@@ -0,0 +1,21 @@
+#include "TileType.h"
+
+std::string toString(TileType t) {
+    switch (t) {
+        case TileType::Empty: return "Empty";
+        case TileType::Solid: return "Solid";
+        case TileType::Fire: return "Fire";
+        case TileType::Water: return "Water";
+        case TileType::HalfFire: return "HalfFire";
+        case TileType::HalfWater: return "HalfWater";
+        case TileType::Coin: return "Coin";
+        case TileType::FireCoin: return "FireCoin";
+        case TileType::WaterCoin: return "WaterCoin";
+        case TileType::EarthCoin: return "EarthCoin";
+        case TileType::ExitFire: return "ExitFire";
+        case TileType::ExitWater: return "ExitWater";
+        case TileType::ExitEarth: return "ExitEarth";
+        case TileType::ExitAir: return "ExitAir";
+    }
+    return "Unknown";
+}
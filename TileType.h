@@ -0,0 +1,28 @@
+#ifndef OOP_TILETYPE_H
+#define OOP_TILETYPE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// latura unui tile in unitati de lume (pixeli la zoom 1)
+inline constexpr int TileSize = 48;
+
+// un byte per tile: Map pastreaza doar tipurile intr-un vector contiguu
+enum class TileType : std::uint8_t { Empty, Solid, Fire, Water, HalfFire, HalfWater, Coin, FireCoin, WaterCoin, EarthCoin, ExitFire, ExitWater, ExitEarth, ExitAir };
+// numarul de tipuri; tine-l sincronizat cu ultimul enumerator (dimensiunea tabelelor indexate dupa TileType)
+inline constexpr std::size_t TileTypeCount = static_cast<std::size_t>(TileType::ExitAir) + 1;
+// multime de tipuri de tile, un bit per TileType
+using TileMask = std::uint16_t;
+static_assert(TileTypeCount <= 16, "TileMask has one bit per TileType");
+constexpr TileMask tileBit(TileType t) { return static_cast<TileMask>(1u << static_cast<unsigned>(t)); }
+
+// toate tipurile de moneda; singurul loc care le enumera
+inline constexpr TileMask CoinTiles = tileBit(TileType::Coin) | tileBit(TileType::FireCoin)
+                                    | tileBit(TileType::WaterCoin) | tileBit(TileType::EarthCoin);
+constexpr bool isCoin(TileType t) { return (CoinTiles & tileBit(t)) != 0; }
+
+
+std::string toString(TileType t);
+
+#endif // OOP_TILETYPE_H
@@ -0,0 +1,48 @@
+#ifndef OOP_TRIPLEBUFFER_H
+#define OOP_TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Un producator si un consumator pe fire diferite, fara lock-uri: producatorul scrie mereu
+// in slotul lui si il publica, consumatorul citeste mereu cea mai noua valoare publicata.
+// Niciunul nu asteapta dupa celalalt; valorile intermediare necitite se pierd.
+template <typename T>
+class TripleBuffer {
+private:
+    static constexpr std::uint8_t IndexMask = 3;
+    // bitul din middle: slotul din mijloc a fost publicat si inca necitit
+    static constexpr std::uint8_t Fresh = 4;
+
+    std::array<T, 3> slots{};
+    // slotul de schimb dintre cele doua fire (indice + Fresh)
+    std::atomic<std::uint8_t> middle{1};
+    // al producatorului
+    std::uint8_t back = 0;
+    // al consumatorului
+    std::uint8_t front = 2;
+
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // producator: slotul de completat; poate contine o valoare mai veche, deci se rescrie complet
+    T& writeSlot() { return slots[back]; }
+    // producator: slotul scris devine cel mai nou; primeste inapoi slotul din mijloc
+    void publish() {
+        back = middle.exchange(static_cast<std::uint8_t>(back | Fresh), std::memory_order_acq_rel) & IndexMask;
+    }
+
+    // consumator: trece la cea mai noua valoare publicata; false daca nu a aparut alta
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & Fresh) == 0) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+    // consumator: valoarea curenta, valabila pana la urmatorul update()
+    const T& read() const { return slots[front]; }
+};
+
+#endif // OOP_TRIPLEBUFFER_H
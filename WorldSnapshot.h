@@ -0,0 +1,88 @@
+#ifndef OOP_WORLDSNAPSHOT_H
+#define OOP_WORLDSNAPSHOT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "Character.h"
+#include "Map.h"
+
+// o modificare de tile facuta de simulare (moneda colectata)
+struct TileEdit {
+    int col = 0;
+    int row = 0;
+    TileType type = TileType::Empty;
+};
+
+// Tot ce are nevoie desenarea dupa un tick, copiat din Simulation: pozitiile personajelor
+// (anterioara si curenta, pentru interpolare), platformele, tile-urile schimbate si starea HUD-ului.
+// Publicat de firul simularii si citit de firul de desenare, fara acces la Simulation.
+struct WorldSnapshot {
+    struct Body {
+        sf::Vector2f previous;
+        sf::Vector2f current;
+        sf::Vector2f size;
+        PlayerType type = PlayerType::Fireboy;
+    };
+    // o platforma mobila, doar cat ii trebuie desenarii: dreptunghiul la inceputul si la sfarsitul
+    // tick-ului (fara spatial hash-ul si limitele de miscare din PlatformStore)
+    struct Platform {
+        sf::FloatRect previous;
+        sf::FloatRect current;
+    };
+
+    std::uint64_t tick = 0;
+    // se schimba la fiecare startLevel/restart: harta desenata trebuie refacuta de la zero
+    std::uint32_t levelEpoch = 0;
+    // momentul (secunde, steady clock) in care a fost atinsa starea curenta si durata unui tick,
+    // pentru alpha-ul interpolarii la desenare
+    double tickTime = 0.0;
+    float tickDt = 1.f / 60.f;
+    // momentul (acelasi ceas) al celui mai nou eveniment de tastatura aplicat pana la acest tick;
+    // 0 = niciunul. Cu momentul afisarii da latenta input -> ecran
+    double latestInputTime = 0.0;
+
+    std::vector<Body> characters;
+    std::vector<Platform> platforms;
+    // toate modificarile de tile-uri de la inceputul nivelului, in ordine
+    std::vector<TileEdit> tileEdits;
+    // se schimba cand un rewind a anulat tile-uri din tileEdits: harta desenata se reface, fara
+    // sa mute camera ca la un levelEpoch nou
+    std::uint32_t tileEditsRevision = 0;
+    // firul simularii merge inapoi in timp: pozitiile se deseneaza fara interpolare
+    bool rewinding = false;
+
+    LevelType level = LevelType::Level1;
+    int collectedCoins = 0;
+    int totalCoins = 0;
+    bool won = false;
+    bool gameOver = false;
+
+    sf::Vector2f position(std::size_t i, float alpha) const {
+        const Body& b = characters[i];
+        return b.previous + (b.current - b.previous) * alpha;
+    }
+    sf::FloatRect platformBounds(std::size_t i, float alpha) const {
+        const Platform& p = platforms[i];
+        return sf::FloatRect(p.previous.left + (p.current.left - p.previous.left) * alpha,
+                             p.previous.top + (p.current.top - p.previous.top) * alpha,
+                             p.current.width, p.current.height);
+    }
+    // dreptunghiul care cuprinde toate personajele (tinta camerei); gol daca nu exista
+    sf::FloatRect charactersFocus(float alpha) const {
+        if (characters.empty()) return {};
+        sf::Vector2f lo = position(0, alpha);
+        sf::Vector2f hi = lo + characters[0].size;
+        for (std::size_t i = 1; i < characters.size(); ++i) {
+            const sf::Vector2f p = position(i, alpha);
+            lo = {std::min(lo.x, p.x), std::min(lo.y, p.y)};
+            hi = {std::max(hi.x, p.x + characters[i].size.x), std::max(hi.y, p.y + characters[i].size.y)};
+        }
+        return sf::FloatRect(lo, hi - lo);
+    }
+};
+
+#endif // OOP_WORLDSNAPSHOT_H
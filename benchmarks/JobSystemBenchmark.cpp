@@ -0,0 +1,90 @@
+// bench_jobs: costul pornirii unui job si scalarea parallelFor cu numarul de fire.
+// Utilizare: bench_jobs [joburi] [elemente] [fire, implicit cate nuclee are masina]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "JobSystem.h"
+
+namespace {
+    template <typename Fn>
+    double secondsFor(Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // de ajuns de scump cat sa conteze mai mult decat planificarea
+    float work(std::size_t i) {
+        float x = static_cast<float>(i % 1024) * 0.001f + 1.f;
+        for (int k = 0; k < 64; ++k) x = std::sqrt(x * x + 0.5f);
+        return x;
+    }
+
+    // sume partiale pe bucati, adunate in ordinea bucatilor: acelasi rezultat cu oricate fire
+    double sumParallel(JobSystem& jobs, std::size_t count, std::size_t grain) {
+        std::vector<double> partial((count + grain - 1) / grain, 0.0);
+        jobs.parallelFor(count, grain, [&](std::size_t begin, std::size_t end) {
+            double s = 0.0;
+            for (std::size_t i = begin; i < end; ++i) s += work(i);
+            partial[begin / grain] = s;
+        });
+        double total = 0.0;
+        for (const double s : partial) total += s;
+        return total;
+    }
+}
+
+int main(int argc, char** argv) {
+    const long jobCount = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 100000;
+    const long items = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 1 << 20;
+    const long threadArg = argc > 3 ? std::strtol(argv[3], nullptr, 10)
+                                     : static_cast<long>(std::max(1u, std::thread::hardware_concurrency()));
+    if (jobCount <= 0 || items <= 0 || threadArg <= 0) {
+        std::cerr << "usage: " << argv[0] << " [jobs > 0] [items > 0] [threads > 0]\n";
+        return 2;
+    }
+    const std::size_t maxThreads = static_cast<std::size_t>(threadArg);
+    std::cout << std::thread::hardware_concurrency() << " hardware threads, up to " << maxThreads << " used\n";
+
+    // pornirea joburilor: spawn + wait pe joburi goale, si bucati de un element in parallelFor
+    {
+        JobSystem jobs(maxThreads);
+        const double spawnSecs = secondsFor([&] {
+            JobSystem::Group group;
+            for (long i = 0; i < jobCount; ++i) jobs.spawn(group, [] {});
+            jobs.wait(group);
+        });
+        const double forSecs = secondsFor([&] {
+            jobs.parallelFor(static_cast<std::size_t>(jobCount), 1, [](std::size_t, std::size_t) {});
+        });
+        std::cout << "spawn + wait: " << spawnSecs / static_cast<double>(jobCount) * 1e9 << " ns/job\n"
+                  << "parallelFor, grain 1: " << forSecs / static_cast<double>(jobCount) * 1e9 << " ns/chunk\n";
+    }
+
+    // scalare: acelasi parallelFor pe 1, 2, 4, ... fire
+    const std::size_t count = static_cast<std::size_t>(items);
+    const std::size_t grain = 1024;
+    double baseSecs = 0.0;
+    double expected = 0.0;
+    bool identical = true;
+    for (std::size_t threads = 1; ; threads = std::min(threads * 2, maxThreads)) {
+        JobSystem jobs(threads);
+        double total = 0.0;
+        const double secs = secondsFor([&] { total = sumParallel(jobs, count, grain); });
+        if (threads == 1) {
+            baseSecs = secs;
+            expected = total;
+        } else if (total != expected) {
+            identical = false;
+        }
+        std::cout << threads << " threads: " << static_cast<double>(count) / secs / 1e6 << " M items/s, speedup x"
+                  << baseSecs / secs << "\n";
+        if (threads == maxThreads) break;
+    }
+    std::cout << "results " << (identical ? "identical" : "DIFFERENT") << "\n";
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// bench_kinematics: integrarea a 10k corpuri (actori si platforme) pe calea scalara vs SIMD.
+// Utilizare: bench_kinematics [corpuri] [iteratii]
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "Kinematics.h"
+
+namespace {
+    // vectorii SoA ai unui lot de corpuri, cu valori deterministe
+    struct Bodies {
+        std::vector<float> posX, posY, velX, velY, walkX, moveX, moveY, width, height;
+        std::vector<std::uint8_t> grounded;
+        std::vector<float> platX, direction, lastDx, speed, xMin, xMax;
+
+        explicit Bodies(std::size_t n)
+            : posX(n), posY(n), velX(n), velY(n), walkX(n), moveX(n), moveY(n), width(n), height(n),
+              grounded(n), platX(n), direction(n), lastDx(n), speed(n), xMin(n), xMax(n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                const float f = static_cast<float>(i % 97);
+                posX[i] = f * 13.f - 40.f;
+                posY[i] = f * 7.f;
+                velX[i] = (i % 3 == 0) ? 0.f : f - 48.f;
+                velY[i] = -f * 4.f;
+                walkX[i] = (i % 2 == 0) ? 2.5f : -2.5f;
+                width[i] = 24.f + static_cast<float>(i % 5);
+                height[i] = 48.f;
+                platX[i] = 100.f + f;
+                direction[i] = (i % 2 == 0) ? 1.f : -1.f;
+                speed[i] = 40.f + f;
+                xMin[i] = 100.f;
+                xMax[i] = 180.f;
+            }
+        }
+
+        Kinematics::IntegrateBatch integrateBatch() {
+            return {velY.data(), velX.data(), walkX.data(), moveX.data(), moveY.data(), velY.size()};
+        }
+        Kinematics::ClampBatch clampBatch() {
+            return {posX.data(), posY.data(), velY.data(), grounded.data(), width.data(), height.data(), posX.size()};
+        }
+        Kinematics::PlatformBatch platformBatch() {
+            return {platX.data(), direction.data(), lastDx.data(), speed.data(), xMin.data(), xMax.data(), platX.size()};
+        }
+        // ca in joc: miscarea dorita se aplica, apoi clamp-ul tine corpurile in lume
+        void applyMoves() {
+            for (std::size_t i = 0; i < posX.size(); ++i) {
+                posX[i] += moveX[i];
+                posY[i] += moveY[i];
+            }
+        }
+    };
+
+    bool same(const std::vector<float>& a, const std::vector<float>& b) {
+        return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+    }
+
+    template <typename Fn>
+    double secondsFor(long iterations, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (long it = 0; it < iterations; ++it) fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void report(const char* name, std::size_t bodies, long iterations, double scalar, double simd) {
+        const double updates = static_cast<double>(bodies) * static_cast<double>(iterations);
+        std::cout << name << ": scalar " << updates / scalar / 1e6 << " M bodies/s, "
+                  << Kinematics::simdName() << " " << updates / simd / 1e6 << " M bodies/s, speedup x"
+                  << scalar / simd << "\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    const long n = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 10000;
+    const long iterations = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 2000;
+    if (n <= 0 || iterations <= 0) {
+        std::cerr << "usage: " << argv[0] << " [bodies > 0] [iterations > 0]\n";
+        return 2;
+    }
+    const std::size_t count = static_cast<std::size_t>(n);
+    constexpr float dt = 1.f / 60.f;
+    constexpr float gravity = 900.f;
+    const sf::FloatRect world(0.f, 0.f, 1280.f, 720.f);
+
+    Bodies scalar(count);
+    Bodies simd(count);
+
+    const double actorsScalar = secondsFor(iterations, [&] {
+        Kinematics::integrateScalar(scalar.integrateBatch(), gravity, dt);
+        scalar.applyMoves();
+        Kinematics::clampToWorldScalar(scalar.clampBatch(), world);
+    });
+    const double actorsSimd = secondsFor(iterations, [&] {
+        Kinematics::integrate(simd.integrateBatch(), gravity, dt);
+        simd.applyMoves();
+        Kinematics::clampToWorld(simd.clampBatch(), world);
+    });
+
+    const double platformsScalar = secondsFor(iterations, [&] {
+        Kinematics::advancePlatformsScalar(scalar.platformBatch(), dt);
+    });
+    const double platformsSimd = secondsFor(iterations, [&] {
+        Kinematics::advancePlatforms(simd.platformBatch(), dt);
+    });
+
+    // cele doua cai trebuie sa dea exact aceiasi biti (simularea ramane determinista)
+    const bool identical = same(scalar.posX, simd.posX) && same(scalar.posY, simd.posY) &&
+                           same(scalar.velY, simd.velY) && scalar.grounded == simd.grounded &&
+                           same(scalar.platX, simd.platX) && same(scalar.direction, simd.direction) &&
+                           same(scalar.lastDx, simd.lastDx);
+
+    std::cout << count << " bodies, " << iterations << " iterations\n";
+    report("actors (integrate + clamp)", count, iterations, actorsScalar, actorsSimd);
+    report("platforms", count, iterations, platformsScalar, platformsSimd);
+    std::cout << "results " << (identical ? "identical" : "DIFFERENT") << "\n";
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+// bench_rewind: memoria istoriei de rewind si costul refacerii unui tick, pe un nivel jucat cu script.
+// Verifica si ca dupa rewind aceleasi comenzi duc exact in aceeasi stare.
+// Utilizare: bench_rewind [nivel 1-4 | fisier de nivel] [secunde de joc]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Replay.h"
+#include "RewindBuffer.h"
+#include "Simulation.h"
+
+namespace {
+    // acelasi script ca oop_headless
+    void scriptedInputs(long tick, std::vector<CharacterInput>& inputs) {
+        for (std::size_t c = 0; c < inputs.size(); ++c) {
+            const long phase = tick + 37 * static_cast<long>(c);
+            inputs[c].right = (phase / 120) % 2 == 0;
+            inputs[c].left = !inputs[c].right;
+            inputs[c].jump = phase % 45 == 0;
+        }
+    }
+
+    StateBytes::Buffer stateOf(const Simulation& sim) {
+        StateBytes::Buffer state;
+        sim.saveState(state);
+        return state;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string level = argc > 1 ? argv[1] : "1";
+    const long seconds = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 300;
+    if (seconds <= 0) {
+        std::cerr << "usage: " << argv[0] << " [1-4 | level file] [game seconds > 0]\n";
+        return 2;
+    }
+
+    Simulation sim;
+    Replay(level, sim.getTickRate()).startLevel(sim);
+    const long ticks = seconds * sim.getTickRate();
+    RewindBuffer history(static_cast<std::size_t>(ticks), static_cast<std::size_t>(sim.getTickRate()));
+    std::vector<CharacterInput> inputs(sim.getCharacters().size());
+    StateBytes::Buffer state = stateOf(sim);
+    const std::size_t rawBytes = state.size();
+    history.push(state);
+
+    // fara restart: istoria acopera toata rularea, chiar daca nivelul s-a terminat intre timp
+    const auto pushStart = std::chrono::steady_clock::now();
+    for (long t = 0; t < ticks; ++t) {
+        scriptedInputs(t, inputs);
+        sim.step(inputs);
+        state.clear();
+        sim.saveState(state);
+        history.push(state);
+    }
+    const double pushSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - pushStart).count();
+    const StateBytes::Buffer finalState = stateOf(sim);
+
+    std::cout << ticks << " ticks (" << seconds << " s of play), " << rawBytes << " bytes per raw state\n";
+    std::cout << "history: " << history.size() << " states, " << history.bytes() << " bytes ("
+              << static_cast<double>(history.bytes()) / static_cast<double>(history.size()) << " per tick, "
+              << static_cast<double>(history.bytes()) / (1024.0 * 1024.0) << " MiB)\n";
+    std::cout << "simulate + save + encode: " << pushSecs * 1e6 / static_cast<double>(ticks) << " us/tick\n";
+
+    // rewind pana la jumatate, tick cu tick, masurand fiecare refacere
+    const long back = ticks / 2;
+    double total = 0.0, worst = 0.0;
+    for (long k = 0; k < back; ++k) {
+        const auto start = std::chrono::steady_clock::now();
+        if (!history.stepBack(state)) {
+            std::cerr << "history ended after " << k << " steps back\n";
+            return 1;
+        }
+        sim.loadState(state);
+        const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        total += secs;
+        worst = std::max(worst, secs);
+    }
+    std::cout << "restore: " << total * 1e6 / static_cast<double>(back) << " us mean, " << worst * 1e6
+              << " us worst over " << back << " ticks\n";
+
+    // din nou inainte cu aceleasi comenzi: determinismul cere exact starea de la final
+    for (long t = ticks - back; t < ticks; ++t) {
+        scriptedInputs(t, inputs);
+        sim.step(inputs);
+    }
+    const bool same = stateOf(sim) == finalState;
+    std::cout << "replay after rewind: " << (same ? "identical" : "DIFFERENT") << " final state\n";
+    return same ? 0 : 1;
+}
@@ -3,6 +3,8 @@ option(USE_ASAN "Use Address Sanitizer" OFF)
 option(USE_MSAN "Use Memory Sanitizer" OFF)
 option(CMAKE_COLOR_DIAGNOSTICS "Enable color diagnostics" ON)
 option(BUILD_SHARED_LIBS "Build SFML as shared library" FALSE)
+option(BUILD_BENCHMARKS "Build the micro-benchmarks in benchmarks/" OFF)
+option(ENABLE_PROFILER "Time frame and tick phases, shown in the HUD with F3" OFF)
 
 # update name in .github/workflows/cmake.yml:27 when changing "bin" name here
 set(DESTINATION_DIR "bin")
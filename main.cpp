@@ -1,21 +1,51 @@
 
 #include <iostream>
+#include <string>
 #include "Game.h"
 #include "GameExceptions.h"
 #include "ResourceManager.h"
-#include "Tile.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 
-int main() {
+namespace {
+    void printUsage(std::ostream& os, const char* program) {
+        os << "usage: " << program << " [--record file.fbwr]\n"
+           << "       " << program << " --help\n";
+    }
+}
+
+// Utilizare: oop [--record fisier.fbwr]; replay-ul se ruleaza cu oop_headless --replay
+int main(int argc, char** argv) {
+    // argumentele se verifica inainte de fereastra: o greseala de tastare nu porneste jocul fara inregistrare
+    std::string recordPath;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout, argv[0]);
+            return 0;
+        }
+        if (arg == "--record" && recordPath.empty() && i + 1 < argc && argv[i + 1][0] != '-') {
+            recordPath = argv[++i];
+            continue;
+        }
+        if (arg == "--record") std::cerr << argv[0] << ": --record needs one file path\n";
+        else std::cerr << argv[0] << ": unknown argument '" << arg << "'\n";
+        printUsage(std::cerr, argv[0]);
+        return 2;
+    }
+
     try {
         Game game(14, 9);
+        if (!recordPath.empty()) {
+            game.recordTo(recordPath);
+        }
         std::cout << game << std::endl;
         game.run();
 
 
         ResourceManager<sf::Texture>::getInstance().clear();
         ResourceManager<sf::Font>::getInstance().clear();
-        Tile::cleanupTextures();
+        TextureAtlas::getInstance().clear();
 
         return 0;
     } catch (const GameError& ge) {